@@ -339,6 +339,23 @@ if(ADIOS2_USE_SST AND NOT WIN32)
   endif()
 endif()
 
+# io_uring, used through the kernel interface so liburing isn't needed
+if(ADIOS2_USE_IOUring AND CMAKE_SYSTEM_NAME STREQUAL "Linux")
+  include(CheckCSourceCompiles)
+  CHECK_C_SOURCE_COMPILES("
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+int main(void) { return IORING_OP_READ + IORING_OP_WRITE + __NR_io_uring_setup; }
+" HAVE_io_uring)
+  if(HAVE_io_uring)
+    set(ADIOS2_HAVE_IOUring TRUE)
+  endif()
+endif()
+if(ADIOS2_USE_IOUring AND NOT ADIOS2_USE_IOUring STREQUAL AUTO AND
+   NOT ADIOS2_HAVE_IOUring)
+  message(FATAL_ERROR "io_uring was requested but linux/io_uring.h with IORING_OP_READ (Linux 5.6) is not available")
+endif()
+
 # DAOS
 find_package(DAOS)
 if(DAOS_FOUND)
@@ -0,0 +1,32 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * CoreTypes.h : types used internally by the core and toolkit classes, not
+ * exposed to the public API
+ */
+
+#ifndef ADIOS2_CORE_CORETYPES_H_
+#define ADIOS2_CORE_CORETYPES_H_
+
+/// \cond EXCLUDE_FROM_DOXYGEN
+#include <cstddef>
+/// \endcond
+
+namespace adios2
+{
+namespace core
+{
+
+/** One memory region for vectored (gather) output, same layout as the POSIX
+ * struct iovec */
+struct iovec
+{
+    const void *iov_base; // Base address of a memory region for output
+    size_t iov_len;       // The size of the memory pointed to by iov_base
+};
+
+} // end namespace core
+} // end namespace adios2
+
+#endif /* ADIOS2_CORE_CORETYPES_H_ */
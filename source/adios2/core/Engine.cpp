@@ -89,6 +89,8 @@ void Engine::LockReaderSelections() noexcept
     m_ReaderSelectionsLocked = true;
 }
 
+void Engine::LoadDeferredMetadata(VariableBase & /*variable*/) {}
+
 size_t Engine::DebugGetDataBufferSize() const
 {
     ThrowUp("DebugGetDataBufferSize");
@@ -447,6 +447,14 @@ public:
      */
     void LockReaderSelections() noexcept;
 
+    /**
+     * Completes the metadata of a variable that the engine registered with
+     * the IO without parsing all of it (VariableBase::m_DeferredMetadata).
+     * Called by IO on first access to the variable.
+     * @param variable
+     */
+    virtual void LoadDeferredMetadata(VariableBase &variable);
+
     /* for adios2 internal testing */
     virtual size_t DebugGetDataBufferSize() const;
 
@@ -20,6 +20,7 @@
 /// \endcond
 
 #include "adios2/common/ADIOSMacros.h"
+#include "adios2/core/Engine.h"
 #include "adios2/helper/adiosFunctions.h"
 #include "adios2/helper/adiosType.h"
 #include <adios2-perfstubs-interface.h>
@@ -86,6 +87,11 @@ Variable<T> *IO::InquireVariable(const std::string &name) noexcept
 
     Variable<T> *variable =
         static_cast<Variable<T> *>(itVariable->second.get());
+    if (variable->m_DeferredMetadata && variable->m_Engine != nullptr)
+    {
+        variable->m_Engine->LoadDeferredMetadata(*variable);
+    }
+
     if (m_ReadStreaming)
     {
         if (!variable->IsValidStep(m_EngineStep + 1))
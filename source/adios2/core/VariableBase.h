@@ -98,6 +98,10 @@ public:
 
     Engine *m_Engine = nullptr;
 
+    /** true: m_Engine has metadata of this variable not parsed yet, loaded
+     * with Engine::LoadDeferredMetadata on first access */
+    bool m_DeferredMetadata = false;
+
     /** Index to Step and blocks' (inside a step) characteristics position in a
      * serial metadata buffer
      * <pre>
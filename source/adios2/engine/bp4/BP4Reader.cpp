@@ -139,6 +139,12 @@ void BP4Reader::PerformGets()
     m_BP4Deserializer.m_DeferredVariables.clear();
 }
 
+void BP4Reader::LoadDeferredMetadata(VariableBase &variable)
+{
+    PERFSTUBS_SCOPED_TIMER("BP4Reader::LoadDeferredMetadata");
+    m_BP4Deserializer.LoadDeferredVariableIndex(variable, *this);
+}
+
 // PRIVATE
 void BP4Reader::Init()
 {
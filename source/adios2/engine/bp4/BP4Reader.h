@@ -51,6 +51,8 @@ public:
 
     void PerformGets() final;
 
+    void LoadDeferredMetadata(VariableBase &variable) final;
+
 private:
     typedef std::chrono::duration<double> Seconds;
     typedef std::chrono::time_point<
@@ -115,16 +115,15 @@ std::string BP5Engine::GetBPSubStreamName(const std::string &name,
 }
 
 std::vector<std::string>
-BP5Engine::GetBPSubStreamNames(const std::vector<std::string> &names) const
-    noexcept
+BP5Engine::GetBPSubStreamNames(const std::vector<std::string> &names,
+                               const size_t subFileIndex) const noexcept
 {
     std::vector<std::string> bpNames;
     bpNames.reserve(names.size());
 
     for (const auto &name : names)
     {
-        bpNames.push_back(
-            GetBPSubStreamName(name, static_cast<unsigned int>(m_RankMPI)));
+        bpNames.push_back(GetBPSubStreamName(name, subFileIndex));
     }
     return bpNames;
 }
@@ -170,6 +169,10 @@ void BP5Engine::ParseParams(IO &io, struct BP5Params &Params)
     auto lf_SetStringParameter = [&](const std::string key,
                                      std::string &parameter, const char *def) {
         auto itKey = io.m_Parameters.find(key);
+        if (def)
+        {
+            parameter = def;
+        }
         if (itKey != io.m_Parameters.end())
         {
             parameter = itKey->second;
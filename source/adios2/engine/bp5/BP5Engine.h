@@ -56,7 +56,8 @@ public:
     static constexpr size_t m_VersionTagLength = 32;
 
     std::vector<std::string>
-    GetBPSubStreamNames(const std::vector<std::string> &names) const noexcept;
+    GetBPSubStreamNames(const std::vector<std::string> &names,
+                        const size_t subFileIndex) const noexcept;
 
     std::vector<std::string>
     GetBPMetadataFileNames(const std::vector<std::string> &names) const
@@ -87,7 +88,19 @@ public:
     MACRO(NodeLocal, Bool, bool, false)                                        \
     MACRO(verbose, Int, int, 0)                                                \
     MACRO(CollectiveMetadata, Bool, bool, true)                                \
-    MACRO(ReaderShortCircuitReads, Bool, bool, false)
+    MACRO(ReaderShortCircuitReads, Bool, bool, false)                         \
+    MACRO(Threads, Int, int, 1)                                                \
+    MACRO(ReadCoalesceGap, Int, int, 4096)                                     \
+    MACRO(SharedMetadata, Bool, bool, false)                                   \
+    MACRO(BufferVType, String, std::string, "chunk")                           \
+    MACRO(BufferChunkSize, Int, int, 16 * 1024 * 1024)                         \
+    MACRO(AsyncWrite, Bool, bool, false)                                       \
+    MACRO(NumAsyncBuffers, Int, int, 2)                                        \
+    MACRO(TwoLevelMetadata, Bool, bool, true)                                  \
+    MACRO(SkipKnownMetaMeta, Bool, bool, true)                                 \
+    MACRO(NumAggregators, Int, int, 0)                                         \
+    MACRO(AggregatorRatio, Int, int, 0)                                        \
+    MACRO(AggregationType, String, std::string, "Chain")
 
     struct BP5Params
     {
@@ -111,13 +124,14 @@ private:
  *   Data Formats:
  *   MetadataIndex file (md.idx)
  *	BP5 header for "Index Table" (64 bytes)
- *      for each Writer, what aggregator writes its data
- *             uint16_t [ WriterCount]
+ *      for each Writer, what aggregator writes its data, i.e. the index
+ *      of the data subfile (data.<index>) holding it
+ *             uint64_t [ WriterCount]
  *	for each timestep:
  *		uint64_t 0 :  CombinedMetaDataPos
  *		uint64_t 1 :  CombinedMetaDataSize
  *		for each Writer
- *		 uint64_t  DataPos (in the file above)
+ *		 uint64_t  DataPos (in the writer's data subfile)
  *
  *   MetaMetadata file (mmd.0) contains FFS format information
  *	for each meta metadata item:
@@ -11,8 +11,10 @@
 
 #include <adios2-perfstubs-interface.h>
 
+#include <algorithm>
 #include <chrono>
 #include <errno.h>
+#include <future>
 
 namespace adios2
 {
@@ -93,14 +95,35 @@ StepStatus BP5Reader::BeginStep(StepMode mode, const float timeoutSeconds)
         m_BP5Deserializer->SetupForTimestep(m_CurrentStep);
 
         size_t pgstart = m_MetadataIndexTable[m_CurrentStep][0];
+        std::vector<char> *MDBuffer = &m_Metadata.m_Buffer;
+        if (m_SharedMetadata)
+        {
+            // metadata is decoded in place, copy this step out of the
+            // read-only shared window
+            const size_t HeaderSize =
+                sizeof(uint64_t) * (1 + 2 * static_cast<size_t>(m_WriterCount));
+            m_StepMetadata.assign(m_SharedMetadata + pgstart,
+                                  m_SharedMetadata + pgstart + HeaderSize);
+            size_t Position = sizeof(uint64_t);
+            size_t StepSize = HeaderSize;
+            for (int i = 0; i < 2 * m_WriterCount; i++)
+            {
+                StepSize += helper::ReadValue<uint64_t>(
+                    m_StepMetadata, Position, m_Minifooter.IsLittleEndian);
+            }
+            m_StepMetadata.assign(m_SharedMetadata + pgstart,
+                                  m_SharedMetadata + pgstart + StepSize);
+            MDBuffer = &m_StepMetadata;
+            pgstart = 0;
+        }
         size_t Position = pgstart + sizeof(uint64_t); // skip total data size
         size_t MDPosition = Position + 2 * sizeof(uint64_t) * m_WriterCount;
         for (int i = 0; i < m_WriterCount; i++)
         {
             // variable metadata for timestep
             size_t ThisMDSize = helper::ReadValue<uint64_t>(
-                m_Metadata.m_Buffer, Position, m_Minifooter.IsLittleEndian);
-            char *ThisMD = m_Metadata.m_Buffer.data() + MDPosition;
+                *MDBuffer, Position, m_Minifooter.IsLittleEndian);
+            char *ThisMD = MDBuffer->data() + MDPosition;
             m_BP5Deserializer->InstallMetaData(ThisMD, ThisMDSize, i);
             MDPosition += ThisMDSize;
         }
@@ -108,8 +131,8 @@ StepStatus BP5Reader::BeginStep(StepMode mode, const float timeoutSeconds)
         {
             // attribute metadata for timestep
             size_t ThisADSize = helper::ReadValue<uint64_t>(
-                m_Metadata.m_Buffer, Position, m_Minifooter.IsLittleEndian);
-            char *ThisAD = m_Metadata.m_Buffer.data() + MDPosition;
+                *MDBuffer, Position, m_Minifooter.IsLittleEndian);
+            char *ThisAD = MDBuffer->data() + MDPosition;
             if (ThisADSize > 0)
                 m_BP5Deserializer->InstallAttributeData(ThisAD, ThisADSize);
             MDPosition += ThisADSize;
@@ -134,39 +157,243 @@ void BP5Reader::EndStep()
     PerformGets();
 }
 
-void BP5Reader::ReadData(const size_t WriterRank, const size_t Timestep,
-                         const size_t StartOffset, const size_t Length,
-                         char *Destination)
+size_t BP5Reader::WriterDataStart(const size_t WriterRank,
+                                  const size_t Timestep) const
 {
-    size_t DataStartPos = m_MetadataIndexTable[Timestep][2];
+    size_t DataStartPos = m_MetadataIndexTable.at(Timestep)[2];
     DataStartPos += WriterRank * sizeof(uint64_t);
-    size_t DataStart = helper::ReadValue<uint64_t>(
-        m_MetadataIndex.m_Buffer, DataStartPos, m_Minifooter.IsLittleEndian);
+    return helper::ReadValue<uint64_t>(m_MetadataIndex.m_Buffer, DataStartPos,
+                                       m_Minifooter.IsLittleEndian);
+}
+
+void BP5Reader::OpenSubFile(const size_t SubFile)
+{
     // check if subfile is already opened
-    if (m_DataFileManager.m_Transports.count(WriterRank) == 0)
+    if (m_DataFileManager.m_Transports.count(SubFile) == 0)
     {
         const std::string subFileName = GetBPSubStreamName(
-            m_Name, WriterRank, m_Minifooter.HasSubFiles, true);
+            m_Name, SubFile, m_Minifooter.HasSubFiles, true);
 
-        m_DataFileManager.OpenFileID(subFileName, WriterRank, Mode::Read,
+        m_DataFileManager.OpenFileID(subFileName, SubFile, Mode::Read,
                                      {{"transport", "File"}}, false);
     }
-    m_DataFileManager.ReadFile(Destination, Length, DataStart + StartOffset,
-                               WriterRank);
+}
+
+std::vector<BP5Reader::ReadRun> BP5Reader::PlanReadRuns(
+    const std::vector<format::BP5Deserializer::ReadRequest> &ReadRequests) const
+{
+    struct Extent
+    {
+        size_t SubFile;
+        size_t Start;
+        size_t Request;
+    };
+    std::vector<Extent> extents;
+    extents.reserve(ReadRequests.size());
+    for (size_t i = 0; i < ReadRequests.size(); ++i)
+    {
+        const auto &Req = ReadRequests[i];
+        if (Req.ReadLength == 0)
+        {
+            continue;
+        }
+        // with aggregation several writers share one data subfile
+        extents.push_back({m_WriterToFileMap.at(Req.WriterRank),
+                           WriterDataStart(Req.WriterRank, Req.Timestep) +
+                               Req.StartOffset,
+                           i});
+    }
+    std::sort(extents.begin(), extents.end(),
+              [](const Extent &a, const Extent &b) {
+                  return (a.SubFile < b.SubFile) ||
+                         (a.SubFile == b.SubFile && a.Start < b.Start);
+              });
+
+    const size_t gap = static_cast<size_t>(
+        m_Parameters.ReadCoalesceGap > 0 ? m_Parameters.ReadCoalesceGap : 0);
+
+    /* Merge extents of the same subfile that overlap or lie within gap
+     * bytes of each other into one run, the bytes in between are read
+     * and thrown away */
+    std::vector<ReadRun> runs;
+    for (const auto &e : extents)
+    {
+        const size_t end = e.Start + ReadRequests[e.Request].ReadLength;
+        if (runs.empty() || runs.back().SubFile != e.SubFile ||
+            e.Start > runs.back().End + gap)
+        {
+            runs.push_back({e.SubFile, e.Start, end, nullptr, false, {}});
+        }
+        else if (end > runs.back().End)
+        {
+            runs.back().End = end;
+        }
+        runs.back().Requests.push_back(e.Request);
+    }
+    return runs;
 }
 
 void BP5Reader::PerformGets()
 {
     PERFSTUBS_SCOPED_TIMER("BP5Reader::PerformGets");
     auto ReadRequests = m_BP5Deserializer->GenerateReadRequests();
-    // Potentially optimize read requests, make contiguous, etc.
-    for (const auto &Req : ReadRequests)
+
+    std::vector<ReadRun> runs = PlanReadRuns(ReadRequests);
+
+    auto lf_FreeRuns = [&]() {
+        for (auto &run : runs)
+        {
+            if (!run.InPlace)
+            {
+                free(run.Buffer);
+            }
+        }
+    };
+
+    /* Allocate one buffer per run and point every request into it. When
+     * the transport maps the subfile in memory the requests point straight
+     * into the mapping and the run is not read at all. Subfiles are opened
+     * here, serially, so the concurrent reads below only look up existing
+     * transports */
+    std::vector<std::vector<size_t>> runsPerSubFile;
+    bool threadSafe = true;
+    size_t totalSize = 0;
+    try
+    {
+        for (size_t r = 0; r < runs.size(); ++r)
+        {
+            auto &run = runs[r];
+            if (runsPerSubFile.empty() || runs[r - 1].SubFile != run.SubFile)
+            {
+                OpenSubFile(run.SubFile);
+                threadSafe = threadSafe &&
+                             m_DataFileManager.FileIsThreadSafe(run.SubFile);
+                runsPerSubFile.emplace_back();
+            }
+            run.Buffer = const_cast<char *>(m_DataFileManager.ReadFileInPlace(
+                run.End - run.Start, run.Start, run.SubFile));
+            run.InPlace = (run.Buffer != nullptr);
+            if (!run.InPlace)
+            {
+                run.Buffer = static_cast<char *>(malloc(run.End - run.Start));
+                if (run.Buffer == nullptr)
+                {
+                    throw std::bad_alloc();
+                }
+                runsPerSubFile.back().push_back(r);
+                totalSize += run.End - run.Start;
+            }
+            for (const size_t i : run.Requests)
+            {
+                auto &Req = ReadRequests[i];
+                Req.DestinationAddr =
+                    run.Buffer +
+                    (WriterDataStart(Req.WriterRank, Req.Timestep) +
+                     Req.StartOffset - run.Start);
+            }
+        }
+    }
+    catch (...)
+    {
+        lf_FreeRuns();
+        throw;
+    }
+
+    /* A piece of a run read by one worker */
+    struct ReadPiece
+    {
+        size_t Run;
+        size_t Offset;
+        size_t Size;
+    };
+    const size_t maxThreads =
+        static_cast<size_t>(m_Parameters.Threads > 1 ? m_Parameters.Threads
+                                                     : 1);
+
+    /* With positional reads that are thread-safe any worker can read any
+     * part of any subfile, so runs are cut in pieces of about an even share
+     * of the total size. Otherwise each worker takes whole subfiles, as
+     * reads of one subfile would be serialized anyway */
+    std::vector<std::vector<ReadPiece>> tasks;
+    if (threadSafe && maxThreads > 1)
+    {
+        const size_t share = (totalSize + maxThreads - 1) / maxThreads;
+        for (size_t r = 0; r < runs.size(); ++r)
+        {
+            if (runs[r].InPlace)
+            {
+                continue;
+            }
+            const size_t runSize = runs[r].End - runs[r].Start;
+            for (size_t offset = 0; offset < runSize; offset += share)
+            {
+                tasks.push_back(
+                    {{r, offset, std::min(share, runSize - offset)}});
+            }
+        }
+    }
+    else
+    {
+        for (const auto &subFileRuns : runsPerSubFile)
+        {
+            if (subFileRuns.empty())
+            {
+                continue;
+            }
+            tasks.emplace_back();
+            for (const size_t r : subFileRuns)
+            {
+                tasks.back().push_back(
+                    {r, 0, runs[r].End - runs[r].Start});
+            }
+        }
+    }
+
+    auto lf_ReadTasks = [&](const size_t first, const size_t stride) {
+        for (size_t t = first; t < tasks.size(); t += stride)
+        {
+            for (const auto &piece : tasks[t])
+            {
+                const auto &run = runs[piece.Run];
+                m_DataFileManager.ReadFile(run.Buffer + piece.Offset,
+                                           piece.Size,
+                                           run.Start + piece.Offset,
+                                           run.SubFile);
+            }
+        }
+    };
+
+    const size_t nThreads = std::min(maxThreads, tasks.size());
+    try
+    {
+        if (nThreads > 1)
+        {
+            std::vector<std::future<void>> futures;
+            futures.reserve(nThreads - 1);
+            for (size_t t = 1; t < nThreads; ++t)
+            {
+                futures.push_back(std::async(std::launch::async,
+                                             lf_ReadTasks, t, nThreads));
+            }
+            lf_ReadTasks(0, nThreads);
+            for (auto &f : futures)
+            {
+                f.get();
+            }
+        }
+        else
+        {
+            lf_ReadTasks(0, 1);
+        }
+        m_BP5Deserializer->FinalizeGets(ReadRequests);
+    }
+    catch (...)
     {
-        ReadData(Req.WriterRank, Req.Timestep, Req.StartOffset, Req.ReadLength,
-                 Req.DestinationAddr);
+        lf_FreeRuns();
+        throw;
     }
 
-    m_BP5Deserializer->FinalizeGets(ReadRequests);
+    lf_FreeRuns();
 }
 
 // PRIVATE
@@ -483,8 +710,15 @@ void BP5Reader::InitBuffer(const TimePoint &timeoutInstant,
 
     if (newIdxSize > 0)
     {
-        // broadcast buffer to all ranks from zero
-        m_Comm.BroadcastVector(m_Metadata.m_Buffer);
+        if (m_Parameters.SharedMetadata)
+        {
+            ShareMetadata();
+        }
+        else
+        {
+            // broadcast buffer to all ranks from zero
+            m_Comm.BroadcastVector(m_Metadata.m_Buffer);
+        }
 
         // broadcast metadata index buffer to all ranks from zero
         m_Comm.BroadcastVector(m_MetadataIndex.m_Buffer);
@@ -500,6 +734,8 @@ void BP5Reader::InitBuffer(const TimePoint &timeoutInstant,
         m_BP5Deserializer = new format::BP5Deserializer(
             m_WriterCount, m_WriterIsRowMajor, m_ReaderIsRowMajor);
         m_BP5Deserializer->m_Engine = this;
+        m_BP5Deserializer->m_Threads = static_cast<size_t>(
+            m_Parameters.Threads > 1 ? m_Parameters.Threads : 1);
 
         InstallMetaMetaData(m_MetaMetadata);
 
@@ -522,6 +758,50 @@ void BP5Reader::InitBuffer(const TimePoint &timeoutInstant,
     }
 }
 
+void BP5Reader::ShareMetadata()
+{
+    const size_t mdSize = m_Comm.BroadcastValue(m_Metadata.m_Buffer.size(), 0);
+
+    // rank 0 of m_Comm is also rank 0 of its node and of the leaders
+    m_NodeComm = m_Comm.GroupByShm("creating node communicator, in call to "
+                                   "BP5Reader Open");
+    const bool isLeader = (m_NodeComm.Rank() == 0);
+    helper::Comm leaderComm =
+        m_Comm.Split(isLeader ? 0 : 1, m_Comm.Rank(),
+                     "creating node leaders communicator, in call to "
+                     "BP5Reader Open");
+
+    char *base = nullptr;
+    m_MetadataWin = m_NodeComm.Win_allocate_shared(
+        isLeader ? mdSize : 0, 1, &base,
+        "allocating shared metadata window, in call to BP5Reader Open");
+    if (isLeader)
+    {
+        if (m_Comm.Rank() == 0)
+        {
+            std::copy(m_Metadata.m_Buffer.begin(), m_Metadata.m_Buffer.end(),
+                      base);
+        }
+        // one copy per node instead of one per rank
+        leaderComm.Bcast(base, mdSize, 0,
+                         "broadcasting metadata to node leaders, in call to "
+                         "BP5Reader Open");
+    }
+    else
+    {
+        size_t segmentSize = 0;
+        int dispUnit = 1;
+        m_NodeComm.Win_shared_query(
+            m_MetadataWin, 0, &segmentSize, &dispUnit, &base,
+            "querying shared metadata window, in call to BP5Reader Open");
+    }
+    leaderComm.Free();
+    m_NodeComm.Barrier();
+
+    m_SharedMetadata = base;
+    std::vector<char>().swap(m_Metadata.m_Buffer);
+}
+
 void BP5Reader::ParseMetadataIndex(format::BufferSTL &bufferSTL,
                                    const size_t absoluteStartPos,
                                    const bool hasHeader, const bool oneStepOnly)
@@ -636,6 +916,14 @@ void BP5Reader::DoClose(const int transportIndex)
     PERFSTUBS_SCOPED_TIMER("BP5Reader::Close");
     m_DataFileManager.CloseFiles();
     m_MDFileManager.CloseFiles();
+    if (m_SharedMetadata)
+    {
+        m_SharedMetadata = nullptr;
+        m_MetadataWin.Free("freeing shared metadata window, in call to "
+                           "BP5Reader Close");
+        m_NodeComm.Free("freeing node communicator, in call to BP5Reader "
+                        "Close");
+    }
 }
 
 #define declare_type(T)                                                        \
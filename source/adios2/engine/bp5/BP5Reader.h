@@ -194,12 +194,41 @@ private:
     format::BufferSTL m_MetadataIndex;
     format::BufferSTL m_MetaMetadata;
     format::BufferSTL m_Metadata;
+
+    /** SharedMetadata: one copy of the metadata per compute node, in a shared
+     * memory window of m_NodeComm, instead of m_Metadata on every rank */
+    helper::Comm m_NodeComm;
+    helper::Comm::Win m_MetadataWin;
+    const char *m_SharedMetadata = nullptr;
+    /** SharedMetadata: private copy of the current step's metadata, which
+     * is decoded in place */
+    std::vector<char> m_StepMetadata;
+    void ShareMetadata();
     uint64_t MetadataExpectedMinFileSize(const std::string &IdxFileName,
                                          bool hasHeader);
     void InstallMetaMetaData(format::BufferSTL MetaMetadata);
-    void ReadData(const size_t WriterRank, const size_t Timestep,
-                  const size_t StartOffset, const size_t Length,
-                  char *Destination);
+
+    /** A contiguous range of one subfile that covers one or more read
+     * requests, read with a single ReadFile call */
+    struct ReadRun
+    {
+        size_t SubFile;
+        size_t Start; // absolute offset in the subfile
+        size_t End;   // one past the last byte
+        char *Buffer;
+        bool InPlace; // Buffer points into a mapped subfile, not allocated
+        std::vector<size_t> Requests; // indices into the request list
+    };
+
+    /** Offset in its subfile of the data written by WriterRank in Timestep */
+    size_t WriterDataStart(const size_t WriterRank,
+                           const size_t Timestep) const;
+    void OpenSubFile(const size_t SubFile);
+    /** Sort read requests by subfile and offset and merge neighbours that
+     * are at most ReadCoalesceGap bytes apart into runs */
+    std::vector<ReadRun> PlanReadRuns(
+        const std::vector<format::BP5Deserializer::ReadRequest> &ReadRequests)
+        const;
 };
 
 } // end namespace engine
@@ -12,9 +12,12 @@
 #include "adios2/common/ADIOSMacros.h"
 #include "adios2/core/IO.h"
 #include "adios2/helper/adiosFunctions.h" //CheckIndexRange
+#include "adios2/toolkit/format/buffer/heap/BufferVSTL.h"
 #include "adios2/toolkit/transport/file/FileFStream.h"
 #include <adios2-perfstubs-interface.h>
 
+#include <algorithm> // std::transform, std::max
+#include <chrono>
 #include <ctime>
 #include <iostream>
 
@@ -40,9 +43,28 @@ BP5Writer::BP5Writer(IO &io, const std::string &name, const Mode mode,
     Init();
 }
 
+BP5Writer::~BP5Writer()
+{
+    if (m_AsyncThread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_AsyncMutex);
+            m_AsyncFinish = true;
+        }
+        m_AsyncCV.notify_all();
+        m_AsyncThread.join();
+    }
+}
+
 StepStatus BP5Writer::BeginStep(StepMode mode, const float timeoutSeconds)
 {
+    if (m_Parameters.AsyncWrite)
+    {
+        WaitForAsyncWrites(static_cast<size_t>(m_Parameters.NumAsyncBuffers) -
+                           1);
+    }
     m_WriterStep++;
+    m_BP5Serializer.InitStep(NewDataBuffer());
     return StepStatus::OK;
 }
 
@@ -59,6 +81,13 @@ void BP5Writer::WriteMetaMetadata(
 {
     for (auto &b : MetaMetaBlocks)
     {
+        if (!m_WrittenMetaMetaIDs
+                 .insert(std::string(b.MetaMetaID, b.MetaMetaIDLen))
+                 .second)
+        {
+            // written in an earlier step
+            continue;
+        }
         m_FileMetaMetadataManager.WriteFiles((char *)&b.MetaMetaIDLen,
                                              sizeof(size_t));
         m_FileMetaMetadataManager.WriteFiles((char *)&b.MetaMetaInfoLen,
@@ -118,22 +147,143 @@ uint64_t BP5Writer::WriteMetadata(
     return MetaDataSize;
 }
 
-void BP5Writer::WriteData(format::BufferV *Data)
+void BP5Writer::WriteData(format::BufferV *Data, const uint64_t DataStart)
 {
     format::BufferV::BufferV_iovec DataVec = Data->DataVec();
     size_t DataSize = 0;
-    int i = 0;
-    while (DataVec[i].iov_base != NULL)
+    size_t nBlocks = 0;
+    while (DataVec[nBlocks].iov_base != NULL)
     {
-        m_FileDataManager.WriteFiles((char *)DataVec[i].iov_base,
-                                     DataVec[i].iov_len);
-        DataSize += DataVec[i].iov_len;
-        i++;
+        DataSize += DataVec[nBlocks].iov_len;
+        nBlocks++;
+    }
+    try
+    {
+        if (m_SharedDataFile)
+        {
+            // m_DataPos was advanced for the whole group at reservation
+            m_FileDataManager.WriteFileAt(DataVec, nBlocks, DataStart);
+        }
+        else if (m_Aggregator.m_IsConsumer)
+        {
+            m_FileDataManager.WriteFiles(DataVec, nBlocks);
+            m_DataPos += DataSize;
+            // the rest of the group, in rank order
+            for (int r = 1; r < m_Aggregator.m_Size; ++r)
+            {
+                WriteMemberData(r);
+            }
+        }
+        else
+        {
+            SendDataToAggregator(DataVec, nBlocks, DataSize);
+        }
+    }
+    catch (...)
+    {
+        delete[] DataVec;
+        throw;
     }
-    m_DataPos += DataSize;
     delete[] DataVec;
 }
 
+uint64_t BP5Writer::ReserveSharedFileData(const uint64_t DataSize)
+{
+    helper::Comm &comm = m_Aggregator.m_Comm;
+    uint64_t offset = 0;
+    comm.Exscan(&DataSize, &offset, 1, helper::Comm::Op::Sum,
+                "computing data offsets in the shared subfile in BP5Writer");
+    if (m_Aggregator.m_Rank == 0)
+    {
+        offset = 0; // undefined after Exscan
+    }
+    uint64_t groupSize = 0;
+    comm.Allreduce(&DataSize, &groupSize, 1, helper::Comm::Op::Sum,
+                   "computing data size of the group in BP5Writer");
+    const uint64_t start = m_DataPos + offset;
+    m_DataPos += groupSize;
+    return start;
+}
+
+void BP5Writer::SendDataToAggregator(const format::BufferV::iovec *DataVec,
+                                     const size_t nBlocks,
+                                     const size_t DataSize)
+{
+    helper::Comm &comm = m_Aggregator.m_Comm;
+    const std::string hint(" sending data to aggregator in BP5Writer\n");
+    const uint64_t header[2] = {nBlocks, DataSize};
+    std::vector<uint64_t> blockSizes(nBlocks);
+    for (size_t i = 0; i < nBlocks; ++i)
+    {
+        blockSizes[i] = DataVec[i].iov_len;
+    }
+
+    // every block goes straight from the BufferV, without packing
+    std::vector<helper::Comm::Req> requests;
+    requests.reserve(nBlocks + 2);
+    requests.push_back(comm.Isend(header, 2, 0, 0, hint));
+    if (nBlocks > 0)
+    {
+        requests.push_back(
+            comm.Isend(blockSizes.data(), nBlocks, 0, 1, hint));
+    }
+    for (size_t i = 0; i < nBlocks; ++i)
+    {
+        requests.push_back(
+            comm.Isend(static_cast<const char *>(DataVec[i].iov_base),
+                       DataVec[i].iov_len, 0, 2, hint));
+    }
+    for (auto &req : requests)
+    {
+        req.Wait(hint);
+    }
+}
+
+void BP5Writer::WriteMemberData(const int memberRank)
+{
+    helper::Comm &comm = m_Aggregator.m_Comm;
+    const std::string hint(" receiving data of rank " +
+                           std::to_string(memberRank) +
+                           " of the aggregator group in BP5Writer\n");
+    uint64_t header[2];
+    comm.Recv(header, 2, memberRank, 0, hint);
+    const size_t nBlocks = header[0];
+    const size_t dataSize = header[1];
+    if (nBlocks == 0)
+    {
+        return;
+    }
+    std::vector<uint64_t> blockSizes(nBlocks);
+    comm.Recv(blockSizes.data(), nBlocks, memberRank, 1, hint);
+
+    // blocks are received back to back and written with one call
+    m_AggregationBuffer.resize(dataSize);
+    std::vector<helper::Comm::Req> requests;
+    requests.reserve(nBlocks);
+    size_t position = 0;
+    for (size_t i = 0; i < nBlocks; ++i)
+    {
+        requests.push_back(comm.Irecv(m_AggregationBuffer.data() + position,
+                                      blockSizes[i], memberRank, 2, hint));
+        position += blockSizes[i];
+    }
+    for (auto &req : requests)
+    {
+        req.Wait(hint);
+    }
+    m_FileDataManager.WriteFiles(m_AggregationBuffer.data(), dataSize);
+    m_DataPos += dataSize;
+}
+
+format::BufferV *BP5Writer::NewDataBuffer()
+{
+    if (m_ChunkPool)
+    {
+        return new format::ChunkV("data buffer", *m_ChunkPool);
+    }
+    return new format::BufferVSTL("data buffer");
+}
+
 void BP5Writer::WriteMetadataFileIndex(uint64_t MetaDataPos,
                                        uint64_t MetaDataSize,
                                        std::vector<uint64_t> DataSizes)
@@ -145,12 +295,16 @@ void BP5Writer::WriteMetadataFileIndex(uint64_t MetaDataPos,
     buf[0] = MetaDataPos;
     buf[1] = MetaDataSize;
     m_FileMetadataIndexManager.WriteFiles((char *)buf, sizeof(buf));
-    m_FileMetadataIndexManager.WriteFiles((char *)m_WriterDataPos.data(),
-                                          DataSizes.size() * sizeof(uint64_t));
-    for (int i = 0; i < DataSizes.size(); i++)
+    /* aggregators append the data of their group in rank order, so each
+     * writer's data starts where the previous writer of its subfile ends */
+    for (size_t i = 0; i < DataSizes.size(); i++)
     {
-        m_WriterDataPos[i] += DataSizes[i];
+        uint64_t &SubFilePos = m_SubFileDataPos[m_WriterSubFiles[i]];
+        m_WriterDataPos[i] = SubFilePos;
+        SubFilePos += DataSizes[i];
     }
+    m_FileMetadataIndexManager.WriteFiles((char *)m_WriterDataPos.data(),
+                                          DataSizes.size() * sizeof(uint64_t));
 }
 
 void BP5Writer::MarshalAttributes()
@@ -226,35 +380,282 @@ void BP5Writer::EndStep()
         TSInfo.NewMetaMetaBlocks, TSInfo.MetaEncodeBuffer,
         TSInfo.AttributeEncodeBuffer, TSInfo.DataBuffer->Size());
 
-    size_t LocalSize = MetaBuffer.size();
-    std::vector<size_t> RecvCounts = m_Comm.GatherValues(LocalSize, 0);
+    if (m_Parameters.TwoLevelMetadata)
+    {
+        AggregateMetadataTwoLevel(MetaBuffer);
+    }
+    else
+    {
+        size_t LocalSize = MetaBuffer.size();
+        std::vector<size_t> RecvCounts = m_Comm.GatherValues(LocalSize, 0);
 
-    std::vector<char> *RecvBuffer = new std::vector<char>;
-    if (m_Comm.Rank() == 0)
+        std::vector<char> *RecvBuffer = new std::vector<char>;
+        if (m_Comm.Rank() == 0)
+        {
+            uint64_t TotalSize = 0;
+            for (auto &n : RecvCounts)
+                TotalSize += n;
+            RecvBuffer->resize(TotalSize);
+        }
+        m_Comm.GathervArrays(MetaBuffer.data(), LocalSize, RecvCounts.data(),
+                             RecvCounts.size(), RecvBuffer->data(), 0);
+
+        if (m_Comm.Rank() == 0)
+        {
+            std::vector<size_t> Starts(RecvCounts.size());
+            size_t Start = 0;
+            for (size_t i = 0; i < RecvCounts.size(); ++i)
+            {
+                Starts[i] = Start;
+                Start += RecvCounts[i];
+            }
+            WriteAggregatedMetadata(RecvBuffer, Starts);
+        }
+        delete RecvBuffer;
+    }
+    uint64_t DataStart = MaxSizeT;
+    if (m_SharedDataFile)
     {
-        uint64_t TotalSize = 0;
-        for (auto &n : RecvCounts)
+        DataStart = ReserveSharedFileData(TSInfo.DataBuffer->Size());
+    }
+    if (m_Parameters.AsyncWrite)
+    {
+        AsyncWriteData(TSInfo.DataBuffer, DataStart);
+        TSInfo.DataBuffer = NULL;
+    }
+    else
+    {
+        WriteData(TSInfo.DataBuffer, DataStart);
+    }
+}
+
+void BP5Writer::InitMetadataAggregation()
+{
+    if (!m_Parameters.TwoLevelMetadata)
+    {
+        return;
+    }
+    m_NodeComm = m_Comm.GroupByShm("creating node communicator for BP5 "
+                                   "metadata aggregation");
+    const bool isLeader = (m_NodeComm.Rank() == 0);
+    // key = world rank keeps rank 0 at rank 0 of the leader communicator
+    m_LeaderComm = m_Comm.Split(isLeader ? 0 : 1, m_Comm.Rank(),
+                                "creating node leader communicator for BP5 "
+                                "metadata aggregation");
+    m_NodeWorldRanks = m_NodeComm.GatherValues(
+        static_cast<uint64_t>(m_Comm.Rank()), 0);
+}
+
+void BP5Writer::AggregateMetadataTwoLevel(const std::vector<char> &MetaBuffer)
+{
+    // gather on the node leader
+    const size_t LocalSize = MetaBuffer.size();
+    std::vector<size_t> NodeCounts = m_NodeComm.GatherValues(LocalSize, 0);
+    std::vector<char> NodeBuffer;
+    if (m_NodeComm.Rank() == 0)
+    {
+        size_t TotalSize = 0;
+        for (const auto n : NodeCounts)
             TotalSize += n;
-        RecvBuffer->resize(TotalSize);
+        NodeBuffer.resize(TotalSize);
+    }
+    m_NodeComm.GathervArrays(MetaBuffer.data(), LocalSize, NodeCounts.data(),
+                             NodeCounts.size(), NodeBuffer.data(), 0);
+    if (m_NodeComm.Rank() != 0)
+    {
+        return;
     }
-    m_Comm.GathervArrays(MetaBuffer.data(), LocalSize, RecvCounts.data(),
-                         RecvCounts.size(), RecvBuffer->data(), 0);
 
+    /* drop meta-meta blocks already sent by another rank of the node, and
+     * with SkipKnownMetaMeta those sent to rank 0 in earlier steps */
+    if (!m_Parameters.SkipKnownMetaMeta)
+    {
+        m_ForwardedMetaMetaIDs.clear();
+    }
+    std::vector<char> LeaderBuffer;
+    LeaderBuffer.reserve(NodeBuffer.size());
+    // (world rank, size) of every block in LeaderBuffer
+    std::vector<uint64_t> LeaderIndex;
+    LeaderIndex.reserve(2 * NodeCounts.size());
+    size_t Position = 0;
+    for (size_t i = 0; i < NodeCounts.size(); ++i)
+    {
+        const size_t Before = LeaderBuffer.size();
+        m_BP5Serializer.AppendMetadataDroppingKnownMetaMeta(
+            NodeBuffer.data() + Position, NodeCounts[i],
+            m_ForwardedMetaMetaIDs, LeaderBuffer);
+        Position += NodeCounts[i];
+        LeaderIndex.push_back(m_NodeWorldRanks[i]);
+        LeaderIndex.push_back(LeaderBuffer.size() - Before);
+    }
+    std::vector<char>().swap(NodeBuffer);
+
+    // gather the node blocks on rank 0
+    const size_t LeaderSize = LeaderBuffer.size();
+    std::vector<size_t> LeaderCounts =
+        m_LeaderComm.GatherValues(LeaderSize, 0);
+    std::vector<size_t> IndexCounts =
+        m_LeaderComm.GatherValues(LeaderIndex.size(), 0);
+    std::vector<char> RecvBuffer;
+    std::vector<uint64_t> RecvIndex;
     if (m_Comm.Rank() == 0)
     {
-        std::vector<format::BP5Base::MetaMetaInfoBlock> UniqueMetaMetaBlocks;
-        std::vector<uint64_t> DataSizes;
-        std::vector<BufferV::iovec> AttributeBlocks;
-        auto Metadata = m_BP5Serializer.BreakoutContiguousMetadata(
-            RecvBuffer, RecvCounts, UniqueMetaMetaBlocks, AttributeBlocks,
-            DataSizes);
-        WriteMetaMetadata(UniqueMetaMetaBlocks);
-        uint64_t ThisMetaDataPos = m_MetaDataPos;
-        uint64_t ThisMetaDataSize = WriteMetadata(Metadata, AttributeBlocks);
-        WriteMetadataFileIndex(ThisMetaDataPos, ThisMetaDataSize, DataSizes);
-    }
-    delete RecvBuffer;
-    WriteData(TSInfo.DataBuffer);
+        size_t TotalSize = 0;
+        for (const auto n : LeaderCounts)
+            TotalSize += n;
+        RecvBuffer.resize(TotalSize);
+        size_t TotalIndex = 0;
+        for (const auto n : IndexCounts)
+            TotalIndex += n;
+        RecvIndex.resize(TotalIndex);
+    }
+    m_LeaderComm.GathervArrays(LeaderBuffer.data(), LeaderSize,
+                               LeaderCounts.data(), LeaderCounts.size(),
+                               RecvBuffer.data(), 0);
+    m_LeaderComm.GathervArrays(LeaderIndex.data(), LeaderIndex.size(),
+                               IndexCounts.data(), IndexCounts.size(),
+                               RecvIndex.data(), 0);
+    if (m_Comm.Rank() != 0)
+    {
+        return;
+    }
+
+    std::vector<size_t> Starts(m_Comm.Size());
+    size_t Start = 0;
+    for (size_t i = 0; i + 1 < RecvIndex.size(); i += 2)
+    {
+        Starts[RecvIndex[i]] = Start;
+        Start += RecvIndex[i + 1];
+    }
+    WriteAggregatedMetadata(&RecvBuffer, Starts);
+}
+
+void BP5Writer::WriteAggregatedMetadata(std::vector<char> *RecvBuffer,
+                                        const std::vector<size_t> &Starts)
+{
+    std::vector<format::BP5Base::MetaMetaInfoBlock> UniqueMetaMetaBlocks;
+    std::vector<uint64_t> DataSizes;
+    std::vector<BufferV::iovec> AttributeBlocks;
+    auto Metadata = m_BP5Serializer.BreakoutMetadata(
+        RecvBuffer, Starts, UniqueMetaMetaBlocks, AttributeBlocks, DataSizes);
+    WriteMetaMetadata(UniqueMetaMetaBlocks);
+    uint64_t ThisMetaDataPos = m_MetaDataPos;
+    uint64_t ThisMetaDataSize = WriteMetadata(Metadata, AttributeBlocks);
+    WriteMetadataFileIndex(ThisMetaDataPos, ThisMetaDataSize, DataSizes);
+}
+
+void BP5Writer::AsyncWriteThread()
+{
+    std::unique_lock<std::mutex> lock(m_AsyncMutex);
+    while (true)
+    {
+        m_AsyncCV.wait(lock, [&]() {
+            return m_AsyncFinish || !m_AsyncQueue.empty();
+        });
+        if (m_AsyncQueue.empty())
+        {
+            break;
+        }
+        const PendingWrite pending = m_AsyncQueue.front();
+        format::BufferV *Data = pending.Data;
+        const bool failed = static_cast<bool>(m_AsyncError);
+        lock.unlock();
+
+        // after a failure the data file is in an unknown state, only drain
+        std::exception_ptr error;
+        const auto tStart = std::chrono::steady_clock::now();
+        if (!failed)
+        {
+            try
+            {
+                WriteData(Data, pending.DataStart);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+        }
+        const std::chrono::duration<double> writeTime =
+            std::chrono::steady_clock::now() - tStart;
+        const uint64_t size = Data->Size();
+        delete Data;
+
+        lock.lock();
+        if (error && !m_AsyncError)
+        {
+            m_AsyncError = error;
+        }
+        ++m_AsyncStats.Steps;
+        m_AsyncStats.Bytes += size;
+        m_AsyncStats.WriteSeconds += writeTime.count();
+        m_AsyncQueue.pop_front();
+        m_AsyncCV.notify_all();
+    }
+}
+
+void BP5Writer::AsyncWriteData(format::BufferV *Data, const uint64_t DataStart)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_AsyncMutex);
+        m_AsyncQueue.push_back({Data, DataStart});
+    }
+    m_AsyncCV.notify_all();
+}
+
+void BP5Writer::WaitForAsyncWrites(const size_t maxQueued)
+{
+    const auto tStart = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> lock(m_AsyncMutex);
+    m_AsyncCV.wait(lock, [&]() { return m_AsyncQueue.size() <= maxQueued; });
+    const std::chrono::duration<double> blockedTime =
+        std::chrono::steady_clock::now() - tStart;
+    m_AsyncStats.BlockedSeconds += blockedTime.count();
+    if (m_AsyncError)
+    {
+        std::exception_ptr error = m_AsyncError;
+        m_AsyncError = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+void BP5Writer::FinishAsyncWrites()
+{
+    if (!m_AsyncThread.joinable())
+    {
+        return;
+    }
+    const auto tStart = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(m_AsyncMutex);
+        m_AsyncFinish = true;
+    }
+    m_AsyncCV.notify_all();
+    m_AsyncThread.join();
+    const std::chrono::duration<double> blockedTime =
+        std::chrono::steady_clock::now() - tStart;
+    m_AsyncStats.BlockedSeconds += blockedTime.count();
+
+    if (m_Parameters.verbose > 0 && m_Comm.Rank() == 0)
+    {
+        const double hidden =
+            (m_AsyncStats.WriteSeconds > 0.0
+                 ? std::max(0.0, 1.0 - m_AsyncStats.BlockedSeconds /
+                                           m_AsyncStats.WriteSeconds)
+                 : 0.0);
+        std::cout << "BP5Writer rank 0 async writes: " << m_AsyncStats.Steps
+                  << " steps, " << m_AsyncStats.Bytes << " bytes, write time "
+                  << m_AsyncStats.WriteSeconds << " s, blocked "
+                  << m_AsyncStats.BlockedSeconds << " s, "
+                  << static_cast<int>(hidden * 100.0)
+                  << "% of the write time overlapped" << std::endl;
+    }
+
+    if (m_AsyncError)
+    {
+        std::exception_ptr error = m_AsyncError;
+        m_AsyncError = nullptr;
+        std::rethrow_exception(error);
+    }
 }
 
 // PRIVATE
@@ -263,8 +664,14 @@ void BP5Writer::Init()
     m_BP5Serializer.m_Engine = this;
     m_RankMPI = m_Comm.Rank();
     InitParameters();
+    InitAggregator();
+    InitMetadataAggregation();
     InitTransports();
     InitBPBuffer();
+    if (m_Parameters.AsyncWrite)
+    {
+        m_AsyncThread = std::thread(&BP5Writer::AsyncWriteThread, this);
+    }
 }
 
 #define declare_type(T)                                                        \
@@ -285,11 +692,84 @@ void BP5Writer::InitParameters()
     ParseParams(m_IO, m_Parameters);
     m_WriteToBB = !(m_Parameters.BurstBufferPath.empty());
     m_DrainBB = m_WriteToBB && m_Parameters.BurstBufferDrain;
+
+    std::string bufferVType = m_Parameters.BufferVType;
+    std::transform(bufferVType.begin(), bufferVType.end(), bufferVType.begin(),
+                   ::tolower);
+    if (bufferVType == "chunk")
+    {
+        if (m_Parameters.BufferChunkSize <= 0)
+        {
+            throw std::invalid_argument(
+                "ERROR: BP5 parameter BufferChunkSize must be > 0, in call "
+                "to Open\n");
+        }
+        m_ChunkPool.reset(new format::ChunkPool(
+            static_cast<size_t>(m_Parameters.BufferChunkSize)));
+    }
+    else if (bufferVType != "stl")
+    {
+        throw std::invalid_argument(
+            "ERROR: Unknown BP5 BufferVType parameter \"" +
+            m_Parameters.BufferVType +
+            "\" (use chunk or stl), in call to Open\n");
+    }
+
+    std::string aggregationType = m_Parameters.AggregationType;
+    std::transform(aggregationType.begin(), aggregationType.end(),
+                   aggregationType.begin(), ::tolower);
+    if (aggregationType == "sharedfile")
+    {
+        m_SharedDataFile = true;
+    }
+    else if (aggregationType != "chain")
+    {
+        throw std::invalid_argument(
+            "ERROR: Unknown BP5 AggregationType parameter \"" +
+            m_Parameters.AggregationType +
+            "\" (use chain or sharedfile), in call to Open\n");
+    }
+
+    if (m_Parameters.AsyncWrite && m_Parameters.NumAsyncBuffers < 2)
+    {
+        throw std::invalid_argument(
+            "ERROR: BP5 parameter NumAsyncBuffers must be >= 2 with "
+            "AsyncWrite, in call to Open\n");
+    }
+}
+
+void BP5Writer::InitAggregator()
+{
+    const int size = m_Comm.Size();
+    int subFiles = size;
+    if (m_Parameters.NumAggregators > 0)
+    {
+        subFiles = std::min(m_Parameters.NumAggregators, size);
+    }
+    else if (m_Parameters.AggregatorRatio > 0)
+    {
+        subFiles = (size + m_Parameters.AggregatorRatio - 1) /
+                   m_Parameters.AggregatorRatio;
+    }
+
+    // one group of consecutive ranks per subfile, its first rank writes
+    m_Aggregator.Init(static_cast<size_t>(subFiles), m_Comm);
+
+    if (m_Parameters.AsyncWrite && m_Aggregator.m_Size > 1 &&
+        !m_SharedDataFile)
+    {
+        throw std::invalid_argument(
+            "ERROR: BP5 parameter AsyncWrite can't be combined with "
+            "NumAggregators/AggregatorRatio (fewer subfiles than writers) "
+            "unless AggregationType=SharedFile, in call to Open\n");
+    }
+
+    m_WriterSubFiles = m_Comm.GatherValues(
+        static_cast<uint64_t>(m_Aggregator.m_SubStreamIndex), 0);
 }
 
 void BP5Writer::InitTransports()
 {
-    // TODO need to add support for aggregators here later
     if (m_IO.m_TransportsParameters.empty())
     {
         Params defaultTransportParameters;
@@ -304,7 +784,7 @@ void BP5Writer::InitTransports()
         m_BBName = m_Parameters.BurstBufferPath + PathSeparator + m_Name;
     }
 
-    if (m_Aggregator.m_IsConsumer)
+    if (m_Aggregator.m_IsConsumer || m_SharedDataFile)
     {
         // Names passed to IO AddTransport option with key "Name"
         const std::vector<std::string> transportsNames =
@@ -312,13 +792,15 @@ void BP5Writer::InitTransports()
                                                 m_IO.m_TransportsParameters);
 
         // /path/name.bp.dir/name.bp.rank
-        m_SubStreamNames = GetBPSubStreamNames(transportsNames);
-        if (m_DrainBB)
+        m_SubStreamNames = GetBPSubStreamNames(
+            transportsNames, m_Aggregator.m_SubStreamIndex);
+        if (m_DrainBB && m_Aggregator.m_IsConsumer)
         {
             const std::vector<std::string> drainTransportNames =
                 m_FileDataManager.GetFilesBaseNames(
                     m_Name, m_IO.m_TransportsParameters);
-            m_DrainSubStreamNames = GetBPSubStreamNames(drainTransportNames);
+            m_DrainSubStreamNames = GetBPSubStreamNames(
+                drainTransportNames, m_Aggregator.m_SubStreamIndex);
             /* start up BB thread */
             //            m_FileDrainer.SetVerbose(
             //				     m_Parameters.BurstBufferVerbose,
@@ -373,6 +855,17 @@ void BP5Writer::InitTransports()
             }
         }
     }
+    if (m_SharedDataFile)
+    {
+        // the other ranks join once the aggregator has created the subfile
+        m_Aggregator.m_Comm.Barrier(
+            "waiting for shared data subfiles to be created in BP5Writer");
+        if (!m_Aggregator.m_IsConsumer)
+        {
+            m_FileDataManager.OpenFiles(m_SubStreamNames, Mode::Append,
+                                        m_IO.m_TransportsParameters, false);
+        }
+    }
 
     if (m_Comm.Rank() == 0)
     {
@@ -518,7 +1011,9 @@ void BP5Writer::MakeHeader(format::BufferSTL &b, const std::string fileType,
     const uint32_t WriterCount = m_Comm.Size();
     helper::CopyToBuffer(buffer, position, &WriterCount);
     // bytes 44-47 aggregator count
-    helper::CopyToBuffer(buffer, position, &WriterCount);
+    const uint32_t AggregatorCount =
+        static_cast<uint32_t>(m_Aggregator.m_SubStreams);
+    helper::CopyToBuffer(buffer, position, &AggregatorCount);
     // byte 48 columnMajor
     // write if data is column major in metadata and data
     const uint8_t columnMajor =
@@ -546,32 +1041,36 @@ void BP5Writer::InitBPBuffer()
         MakeHeader(bi, "Index Table", true);
         m_FileMetadataIndexManager.WriteFiles(bi.m_Buffer.data(),
                                               bi.m_Position);
-        std::vector<uint64_t> Assignment(m_Comm.Size());
-        for (uint64_t i = 0; i < m_Comm.Size(); i++)
-        {
-            Assignment[i] = i; // Change when we do aggregation
-        }
         // where each rank's data will end up
-        m_FileMetadataIndexManager.WriteFiles((char *)Assignment.data(),
-                                              sizeof(Assignment[0]) *
-                                                  Assignment.size());
+        m_FileMetadataIndexManager.WriteFiles(
+            (char *)m_WriterSubFiles.data(),
+            sizeof(m_WriterSubFiles[0]) * m_WriterSubFiles.size());
     }
-    if (m_Aggregator.m_IsConsumer)
+    if (m_Aggregator.m_IsConsumer || m_SharedDataFile)
     {
         format::BufferSTL d;
         MakeHeader(d, "Data", false);
-        m_FileDataManager.WriteFiles(d.m_Buffer.data(), d.m_Position);
+        if (m_Aggregator.m_IsConsumer)
+        {
+            m_FileDataManager.WriteFiles(d.m_Buffer.data(), d.m_Position);
+        }
         m_DataPos = d.m_Position;
-        m_WriterDataPos.resize(m_Comm.Size());
-        for (auto &DataPos : m_WriterDataPos)
+        if (m_Comm.Rank() == 0)
         {
-            DataPos = m_DataPos;
+            // all subfiles start with a header of the same size
+            m_WriterDataPos.resize(m_Comm.Size());
+            m_SubFileDataPos.assign(m_Aggregator.m_SubStreams, m_DataPos);
         }
     }
 }
 
 void BP5Writer::DoFlush(const bool isFinal, const int transportIndex)
 {
+    if (m_AsyncThread.joinable())
+    {
+        // the data transport is in use by the background writer
+        WaitForAsyncWrites(0);
+    }
     m_FileMetadataManager.FlushFiles();
     m_FileMetaMetadataManager.FlushFiles();
     m_FileDataManager.FlushFiles();
@@ -596,9 +1095,12 @@ void BP5Writer::DoClose(const int transportIndex)
     PERFSTUBS_SCOPED_TIMER("BP5Writer::Close");
     PerformPuts();
 
+    FinishAsyncWrites();
+
     DoFlush(true, transportIndex);
 
     m_FileDataManager.CloseFiles(transportIndex);
+    m_Aggregator.Close();
     // Delete files from temporary storage if draining was on
 
     if (m_Comm.Rank() == 0)
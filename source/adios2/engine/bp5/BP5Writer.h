@@ -17,8 +17,17 @@
 #include "adios2/toolkit/burstbuffer/FileDrainerSingleThread.h"
 #include "adios2/toolkit/format/bp5/BP5Serializer.h"
 #include "adios2/toolkit/format/buffer/BufferV.h"
+#include "adios2/toolkit/format/buffer/chunk/ChunkV.h"
 #include "adios2/toolkit/transportman/TransportMan.h"
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+
 namespace adios2
 {
 namespace core
@@ -39,7 +48,7 @@ public:
     BP5Writer(IO &io, const std::string &name, const Mode mode,
               helper::Comm comm);
 
-    ~BP5Writer() = default;
+    ~BP5Writer();
 
     StepStatus BeginStep(StepMode mode,
                          const float timeoutSeconds = -1.0) final;
@@ -48,6 +57,10 @@ public:
     void EndStep() final;
 
 private:
+    /** Chunks reused by the data buffers of all steps (BufferVType=chunk),
+     * declared before m_BP5Serializer so that it outlives its buffers */
+    std::unique_ptr<format::ChunkPool> m_ChunkPool;
+
     /** Single object controlling BP buffering */
     format::BP5Serializer m_BP5Serializer;
 
@@ -127,7 +140,86 @@ private:
     WriteMetadata(const std::vector<format::BufferV::iovec> MetaDataBlocks,
                   const std::vector<format::BufferV::iovec> AttributeBlocks);
 
-    void WriteData(format::BufferV *Data);
+    /** Write the step data, at DataStart in the shared subfile with
+     * AggregationType=SharedFile (MaxSizeT otherwise) */
+    void WriteData(format::BufferV *Data, const uint64_t DataStart);
+
+    /** Sets up the aggregator groups, one per data subfile, from the
+     * NumAggregators or AggregatorRatio parameters */
+    void InitAggregator();
+    /** Non-aggregator ranks: send the step data to the group's aggregator */
+    void SendDataToAggregator(const format::BufferV::iovec *DataVec,
+                              const size_t nBlocks, const size_t DataSize);
+    /** Aggregator: receive the step data of memberRank and write it */
+    void WriteMemberData(const int memberRank);
+    /** receive buffer for the data of the group members (aggregator only) */
+    std::vector<char> m_AggregationBuffer;
+    /** AggregationType=SharedFile: every rank of a group writes its own data
+     * into the group's subfile, at an offset agreed on with Exscan */
+    bool m_SharedDataFile = false;
+    /** Collective over the aggregator group: reserve DataSize bytes in the
+     * shared subfile for this step
+     * @return offset of this rank's data in the subfile */
+    uint64_t ReserveSharedFileData(const uint64_t DataSize);
+
+    /* Two-level metadata aggregation (TwoLevelMetadata=true): metadata is
+     * gathered to a leader on every node (m_NodeComm), the leaders drop
+     * duplicated meta-meta blocks and forward to rank 0 (m_LeaderComm) */
+    helper::Comm m_NodeComm;
+    helper::Comm m_LeaderComm;
+    /** world rank of each m_NodeComm rank, on node leaders only */
+    std::vector<uint64_t> m_NodeWorldRanks;
+    /** meta-meta blocks this node leader already sent to rank 0 */
+    std::unordered_set<std::string> m_ForwardedMetaMetaIDs;
+    /** meta-meta blocks already in the meta-metadata file (rank 0) */
+    std::unordered_set<std::string> m_WrittenMetaMetaIDs;
+
+    void InitMetadataAggregation();
+    void AggregateMetadataTwoLevel(const std::vector<char> &MetaBuffer);
+    /** Write the metadata of all ranks gathered on rank 0, the block of
+     * rank i starts at Starts[i] in RecvBuffer */
+    void WriteAggregatedMetadata(std::vector<char> *RecvBuffer,
+                                 const std::vector<size_t> &Starts);
+
+    /** @return new, empty data buffer of the type set by BufferVType */
+    format::BufferV *NewDataBuffer();
+
+    /* Asynchronous data writes (AsyncWrite=true): EndStep hands the step's
+     * data buffer to a background thread that writes the buffers in step
+     * order, BeginStep only blocks while NumAsyncBuffers buffers (including
+     * the one about to be filled) would be in memory */
+    std::thread m_AsyncThread;
+    std::mutex m_AsyncMutex;
+    std::condition_variable m_AsyncCV;
+    struct PendingWrite
+    {
+        format::BufferV *Data;
+        uint64_t DataStart; // see WriteData
+    };
+    /** buffers waiting to be written, the front one is being written */
+    std::deque<PendingWrite> m_AsyncQueue;
+    bool m_AsyncFinish = false;
+    /** first failure of the background thread, rethrown on the main thread
+     */
+    std::exception_ptr m_AsyncError;
+
+    struct AsyncWriteStats
+    {
+        size_t Steps = 0;
+        uint64_t Bytes = 0;
+        double WriteSeconds = 0.0;   // spent writing in the background
+        double BlockedSeconds = 0.0; // main thread waited for the writer
+    };
+    AsyncWriteStats m_AsyncStats;
+
+    void AsyncWriteThread();
+    /** Queue Data (taking ownership) for the background writer */
+    void AsyncWriteData(format::BufferV *Data, const uint64_t DataStart);
+    /** Block until at most maxQueued buffers are waiting or being written,
+     * rethrows a failure of the background writer */
+    void WaitForAsyncWrites(const size_t maxQueued);
+    /** Write out all queued buffers and stop the background thread */
+    void FinishAsyncWrites();
 
     void PopulateMetadataIndexFileContent(
         format::BufferSTL &buffer, const uint64_t currentStep,
@@ -169,7 +261,12 @@ private:
     uint32_t m_MarshaledAttributesCount =
         0; // updated during EndStep/MarshalAttributes
 
+    /* rank 0 only: data subfile of every writer, the position of each
+     * writer's data in its subfile for the current step, and the current
+     * end of every subfile */
+    std::vector<uint64_t> m_WriterSubFiles;
     std::vector<uint64_t> m_WriterDataPos;
+    std::vector<uint64_t> m_SubFileDataPos;
     void MakeHeader(format::BufferSTL &b, const std::string fileType,
                     const bool isActive);
 };
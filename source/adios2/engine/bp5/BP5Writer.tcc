@@ -41,9 +41,11 @@ void BP5Writer::PutCommon(Variable<T> &variable, const T *values, bool sync)
         DimCount = variable.m_Count.size();
         Count = variable.m_Count.data();
     }
+    // data is written after EndStep returns in async mode, so always copy
     m_BP5Serializer.Marshal((void *)&variable, variable.m_Name.c_str(),
                             variable.m_Type, variable.m_ElementSize, DimCount,
-                            Shape, Count, Start, values, sync);
+                            Shape, Count, Start, values,
+                            sync || m_Parameters.AsyncWrite);
 }
 
 } // end namespace engine
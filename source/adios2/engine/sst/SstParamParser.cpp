@@ -195,6 +195,10 @@ void SstParamParser::ParseParams(IO &io, struct _SstParams &Params)
             {
                 parameter = SstQueueFullDiscard;
             }
+            else if (method == "spill")
+            {
+                parameter = SstQueueFullSpill;
+            }
             else
             {
                 throw std::invalid_argument(
@@ -596,6 +596,10 @@ void SstReader::BP5PerformGets()
 {
     auto ReadRequests = m_BP5Deserializer->GenerateReadRequests();
     std::vector<void *> sstReadHandlers;
+    for (auto &Req : ReadRequests)
+    {
+        Req.DestinationAddr = (char *)malloc(Req.ReadLength);
+    }
     for (const auto &Req : ReadRequests)
     {
         void *dp_info = NULL;
@@ -618,6 +622,10 @@ void SstReader::BP5PerformGets()
     }
 
     m_BP5Deserializer->FinalizeGets(ReadRequests);
+    for (const auto &Req : ReadRequests)
+    {
+        free(Req.DestinationAddr);
+    }
 }
 
 void SstReader::PerformGets()
@@ -285,9 +285,18 @@ void SstWriter::EndStep()
         newblock->MetaMetaBlocks = MetaMetaBlocks;
         newblock->metadata.DataSize = TSInfo->MetaEncodeBuffer->m_FixedSize;
         newblock->metadata.block = TSInfo->MetaEncodeBuffer->Data();
+        // hand every block of the data buffer to SST as it is, referenced
+        // user data included, they are kept until the readers release them
         format::BufferV::BufferV_iovec iovec = TSInfo->DataBuffer->DataVec();
-        newblock->data.DataSize = iovec[0].iov_len;
-        newblock->data.block = (char *)iovec[0].iov_base;
+        for (size_t j = 0; iovec[j].iov_base; ++j)
+        {
+            newblock->data.push_back(
+                {iovec[j].iov_len, (char *)iovec[j].iov_base});
+        }
+        if (newblock->data.empty())
+        {
+            newblock->data.push_back({0, NULL});
+        }
         newblock->TSInfo = TSInfo;
         delete[] iovec;
         if (TSInfo->AttributeEncodeBuffer)
@@ -302,10 +311,12 @@ void SstWriter::EndStep()
             newblock->attribute_data.DataSize = 0;
             newblock->attribute_data.block = NULL;
         }
-        SstProvideTimestepMM(m_Output, &newblock->metadata, &newblock->data,
-                             m_WriterStep, lf_FreeBlocks, newblock,
-                             &newblock->attribute_data, NULL, newblock,
-                             MetaMetaBlocks);
+        SstProvideTimestepMMV(m_Output, &newblock->metadata,
+                              newblock->data.data(),
+                              static_cast<int>(newblock->data.size()),
+                              m_WriterStep, lf_FreeBlocks, newblock,
+                              &newblock->attribute_data, NULL, newblock,
+                              MetaMetaBlocks);
     }
     else if (Params.MarshalMethod == SstMarshalBP)
     {
@@ -372,11 +383,11 @@ void SstWriter::Init()
 #define declare_type(T)                                                        \
     void SstWriter::DoPutSync(Variable<T> &variable, const T *values)          \
     {                                                                          \
-        PutSyncCommon(variable, values);                                       \
+        PutCommon(variable, values, true);                                     \
     }                                                                          \
     void SstWriter::DoPutDeferred(Variable<T> &variable, const T *values)      \
     {                                                                          \
-        PutSyncCommon(variable, values);                                       \
+        PutCommon(variable, values, false);                                    \
     }
 
 ADIOS2_FOREACH_STDTYPE_1ARG(declare_type)
@@ -19,6 +19,7 @@
 #include "adios2/toolkit/sst/sst.h"
 
 #include <memory>
+#include <vector>
 
 namespace adios2
 {
@@ -53,10 +54,7 @@ private:
 #undef declare_type
 
     template <class T>
-    void PutSyncCommon(Variable<T> &variable, const T *values);
-
-    template <class T>
-    void PutDeferredCommon(Variable<T> &variable, const T *values);
+    void PutCommon(Variable<T> &variable, const T *values, const bool sync);
 
     struct BP3DataBlock
     {
@@ -66,7 +64,7 @@ private:
     };
     struct BP5DataBlock
     {
-        _SstData data;
+        std::vector<_SstData> data;
         _SstData metadata;
         _SstData attribute_data;
         SstMetaMetaList MetaMetaBlocks;
@@ -24,7 +24,8 @@ namespace engine
 {
 
 template <class T>
-void SstWriter::PutSyncCommon(Variable<T> &variable, const T *values)
+void SstWriter::PutCommon(Variable<T> &variable, const T *values,
+                          const bool sync)
 {
     PERFSTUBS_SCOPED_TIMER_FUNC();
     variable.SetData(values);
@@ -64,10 +65,13 @@ void SstWriter::PutSyncCommon(Variable<T> &variable, const T *values)
         }
         else
         {
+            // with ZeroCopyDeferredPuts, deferred data is only referenced and
+            // served to readers from the application's buffer
+            const bool copy = sync || !Params.ZeroCopyDeferredPuts;
             m_BP5Serializer->Marshal((void *)&variable, variable.m_Name.c_str(),
                                      variable.m_Type, variable.m_ElementSize,
                                      DimCount, Shape, Count, Start, values,
-                                     true);
+                                     copy);
         }
     }
     else if (Params.MarshalMethod == SstMarshalBP)
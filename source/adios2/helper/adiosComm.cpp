@@ -83,6 +83,18 @@ bool Comm::IsMPI() const { return m_Impl->IsMPI(); }
 
 void Comm::Barrier(const std::string &hint) const { m_Impl->Barrier(hint); }
 
+Comm::Win Comm::Win_allocate_shared(size_t size, int dispUnit, void *baseptr,
+                                    const std::string &hint) const
+{
+    return m_Impl->Win_allocate_shared(size, dispUnit, baseptr, hint);
+}
+
+void Comm::Win_shared_query(Win &win, int rank, size_t *size, int *dispUnit,
+                            void *baseptr, const std::string &hint) const
+{
+    m_Impl->Win_shared_query(win, rank, size, dispUnit, baseptr, hint);
+}
+
 std::string Comm::BroadcastFile(const std::string &fileName,
                                 const std::string hint,
                                 const int rankSource) const
@@ -135,6 +147,25 @@ Comm::Status Comm::Req::Wait(const std::string &hint)
     return status;
 }
 
+Comm::Win::Win() = default;
+
+Comm::Win::Win(std::unique_ptr<CommWinImpl> impl) : m_Impl(std::move(impl)) {}
+
+Comm::Win::~Win() = default;
+
+Comm::Win::Win(Win &&win) = default;
+
+Comm::Win &Comm::Win::operator=(Win &&win) = default;
+
+void Comm::Win::Free(const std::string &hint)
+{
+    if (m_Impl)
+    {
+        m_Impl->Free(hint);
+        m_Impl.reset();
+    }
+}
+
 CommImpl::~CommImpl() = default;
 
 size_t CommImpl::SizeOf(Datatype datatype) { return ToSize(datatype); }
@@ -149,9 +180,18 @@ Comm::Req CommImpl::MakeReq(std::unique_ptr<CommReqImpl> impl)
     return Comm::Req(std::move(impl));
 }
 
+Comm::Win CommImpl::MakeWin(std::unique_ptr<CommWinImpl> impl)
+{
+    return Comm::Win(std::move(impl));
+}
+
 CommImpl *CommImpl::Get(Comm const &comm) { return comm.m_Impl.get(); }
 
+CommWinImpl *CommImpl::Get(Comm::Win const &win) { return win.m_Impl.get(); }
+
 CommReqImpl::~CommReqImpl() = default;
 
+CommWinImpl::~CommWinImpl() = default;
+
 } // end namespace helper
 } // end namespace adios2
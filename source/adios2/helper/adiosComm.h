@@ -19,6 +19,7 @@ namespace helper
 
 class CommImpl;
 class CommReqImpl;
+class CommWinImpl;
 
 /** @brief Encapsulation for communication in a multi-process environment.  */
 class Comm
@@ -26,6 +27,7 @@ class Comm
 public:
     class Req;
     class Status;
+    class Win;
 
     /**
      * @brief Enumeration of element-wise accumulation operations.
@@ -215,6 +217,14 @@ public:
     void Bcast(T *buffer, size_t count, int root,
                const std::string &hint = std::string()) const;
 
+    /**
+     * Exclusive prefix reduction as MPI_Exscan: recvbuf on rank i holds the
+     * reduction of sendbuf over ranks 0..i-1. recvbuf on rank 0 is undefined.
+     */
+    template <typename T>
+    void Exscan(const T *sendbuf, T *recvbuf, size_t count, Op op,
+                const std::string &hint = std::string()) const;
+
     template <typename TSend, typename TRecv>
     void Gather(const TSend *sendbuf, size_t sendcount, TRecv *recvbuf,
                 size_t recvcount, int root,
@@ -254,6 +264,30 @@ public:
     Req Irecv(T *buffer, const size_t count, int source, int tag,
               const std::string &hint = std::string()) const;
 
+    /**
+     * @brief Allocate a window of memory shared by all processes of the
+     * communicator, which must be able to share memory (see GroupByShm).
+     * @param size Bytes contributed by this process, may be zero.
+     * @param dispUnit Local unit size for displacements, in bytes.
+     * @param baseptr Output, address (void **) of this process' segment.
+     * @param hint Description of std::runtime_error exception on error.
+     */
+    Win Win_allocate_shared(size_t size, int dispUnit, void *baseptr,
+                            const std::string &hint = std::string()) const;
+
+    /**
+     * @brief Query the segment of a process in a shared memory window.
+     * @param win Window from Win_allocate_shared.
+     * @param rank Process owning the segment.
+     * @param size Output, size of the segment in bytes.
+     * @param dispUnit Output, unit size of the segment.
+     * @param baseptr Output, address (void **) of the segment.
+     * @param hint Description of std::runtime_error exception on error.
+     */
+    void Win_shared_query(Win &win, int rank, size_t *size, int *dispUnit,
+                          void *baseptr,
+                          const std::string &hint = std::string()) const;
+
 private:
     friend class CommImpl;
 
@@ -316,6 +350,59 @@ private:
     std::unique_ptr<CommReqImpl> m_Impl;
 };
 
+class Comm::Win
+{
+public:
+    /**
+     * @brief Default constructor.  Produces an empty window.
+     *
+     * An empty window may not be used.
+     */
+    Win();
+
+    /**
+     * @brief Move constructor.  Moves window state from that given.
+     *
+     * The moved-from window is left empty and may not be used.
+     */
+    Win(Win &&);
+
+    /**
+     * @brief Deleted copy constructor.  A window may not be copied.
+     */
+    Win(Win const &) = delete;
+
+    ~Win();
+
+    /**
+     * @brief Move assignment.  Moves window state from that given.
+     *
+     * The moved-from window is left empty and may not be used.
+     */
+    Win &operator=(Win &&);
+
+    /**
+     * @brief Deleted copy assignment.  A window may not be copied.
+     */
+    Win &operator=(Win const &) = delete;
+
+    /**
+     * @brief Free the window, collective on the communicator that
+     * allocated it.
+     * @param hint Description of std::runtime_error exception on error.
+     *
+     * On return, the window is empty.
+     */
+    void Free(const std::string &hint = std::string());
+
+private:
+    friend class CommImpl;
+
+    explicit Win(std::unique_ptr<CommWinImpl> impl);
+
+    std::unique_ptr<CommWinImpl> m_Impl;
+};
+
 class Comm::Status
 {
 public:
@@ -398,6 +485,10 @@ public:
     virtual void Bcast(void *buffer, size_t count, Datatype datatype, int root,
                        const std::string &hint) const = 0;
 
+    virtual void Exscan(const void *sendbuf, void *recvbuf, size_t count,
+                        Datatype datatype, Comm::Op op,
+                        const std::string &hint) const = 0;
+
     virtual void Gather(const void *sendbuf, size_t sendcount,
                         Datatype sendtype, void *recvbuf, size_t recvcount,
                         Datatype recvtype, int root,
@@ -437,11 +528,21 @@ public:
                             int source, int tag,
                             const std::string &hint) const = 0;
 
+    virtual Comm::Win Win_allocate_shared(size_t size, int dispUnit,
+                                          void *baseptr,
+                                          const std::string &hint) const = 0;
+
+    virtual void Win_shared_query(Comm::Win &win, int rank, size_t *size,
+                                  int *dispUnit, void *baseptr,
+                                  const std::string &hint) const = 0;
+
     static size_t SizeOf(Datatype datatype);
 
     static Comm MakeComm(std::unique_ptr<CommImpl> impl);
     static Comm::Req MakeReq(std::unique_ptr<CommReqImpl> impl);
+    static Comm::Win MakeWin(std::unique_ptr<CommWinImpl> impl);
     static CommImpl *Get(Comm const &comm);
+    static CommWinImpl *Get(Comm::Win const &win);
 };
 
 class CommReqImpl
@@ -451,6 +552,13 @@ public:
     virtual Comm::Status Wait(const std::string &hint) = 0;
 };
 
+class CommWinImpl
+{
+public:
+    virtual ~CommWinImpl() = 0;
+    virtual void Free(const std::string &hint) = 0;
+};
+
 } // end namespace helper
 } // end namespace adios2
 
@@ -199,6 +199,14 @@ void Comm::Bcast(T *buffer, const size_t count, int root,
     return m_Impl->Bcast(buffer, count, CommImpl::GetDatatype<T>(), root, hint);
 }
 
+template <typename T>
+void Comm::Exscan(const T *sendbuf, T *recvbuf, size_t count, Op op,
+                  const std::string &hint) const
+{
+    return m_Impl->Exscan(sendbuf, recvbuf, count, CommImpl::GetDatatype<T>(),
+                          op, hint);
+}
+
 template <typename TSend, typename TRecv>
 void Comm::Gather(const TSend *sendbuf, size_t sendcount, TRecv *recvbuf,
                   size_t recvcount, int root, const std::string &hint) const
@@ -38,6 +38,22 @@ public:
 
 CommReqImplDummy::~CommReqImplDummy() = default;
 
+class CommWinImplDummy : public CommWinImpl
+{
+public:
+    CommWinImplDummy(size_t size) : m_Buffer(size) {}
+    ~CommWinImplDummy() override;
+
+    void Free(const std::string &hint) override;
+
+    /** the only segment, owned by the single process */
+    std::vector<char> m_Buffer;
+};
+
+CommWinImplDummy::~CommWinImplDummy() = default;
+
+void CommWinImplDummy::Free(const std::string &) { m_Buffer.clear(); }
+
 class CommImplDummy : public CommImpl
 {
 public:
@@ -73,6 +89,10 @@ public:
     void Bcast(void *buffer, size_t count, Datatype datatype, int root,
                const std::string &hint) const override;
 
+    void Exscan(const void *sendbuf, void *recvbuf, size_t count,
+                Datatype datatype, Comm::Op op,
+                const std::string &hint) const override;
+
     void Gather(const void *sendbuf, size_t sendcount, Datatype sendtype,
                 void *recvbuf, size_t recvcount, Datatype recvtype, int root,
                 const std::string &hint) const override;
@@ -104,6 +124,13 @@ public:
 
     Comm::Req Irecv(void *buffer, size_t count, Datatype datatype, int source,
                     int tag, const std::string &hint) const override;
+
+    Comm::Win Win_allocate_shared(size_t size, int dispUnit, void *baseptr,
+                                  const std::string &hint) const override;
+
+    void Win_shared_query(Comm::Win &win, int rank, size_t *size,
+                          int *dispUnit, void *baseptr,
+                          const std::string &hint) const override;
 };
 
 CommImplDummy::~CommImplDummy() = default;
@@ -174,6 +201,12 @@ void CommImplDummy::Bcast(void *, size_t, Datatype, int,
 {
 }
 
+void CommImplDummy::Exscan(const void *, void *, size_t, Datatype, Comm::Op,
+                           const std::string &) const
+{
+    // recvbuf of rank 0 is undefined
+}
+
 void CommImplDummy::Gather(const void *sendbuf, size_t sendcount,
                            Datatype sendtype, void *recvbuf, size_t recvcount,
                            Datatype recvtype, int root,
@@ -285,6 +318,25 @@ Comm::Req CommImplDummy::Irecv(void *, size_t, Datatype, int, int,
     return MakeReq(std::move(req));
 }
 
+Comm::Win CommImplDummy::Win_allocate_shared(size_t size, int,
+                                             void *baseptr,
+                                             const std::string &) const
+{
+    auto win = std::unique_ptr<CommWinImplDummy>(new CommWinImplDummy(size));
+    *static_cast<char **>(baseptr) = win->m_Buffer.data();
+    return MakeWin(std::move(win));
+}
+
+void CommImplDummy::Win_shared_query(Comm::Win &win, int, size_t *size,
+                                     int *dispUnit, void *baseptr,
+                                     const std::string &) const
+{
+    CommWinImplDummy *w = dynamic_cast<CommWinImplDummy *>(CommImpl::Get(win));
+    *size = w->m_Buffer.size();
+    *dispUnit = 1;
+    *static_cast<char **>(baseptr) = w->m_Buffer.data();
+}
+
 Comm::Status CommReqImplDummy::Wait(const std::string &hint)
 {
     Comm::Status status;
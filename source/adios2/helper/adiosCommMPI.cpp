@@ -108,6 +108,27 @@ public:
 
 CommReqImplMPI::~CommReqImplMPI() = default;
 
+class CommWinImplMPI : public CommWinImpl
+{
+public:
+    CommWinImplMPI() = default;
+    ~CommWinImplMPI() override;
+
+    void Free(const std::string &hint) override;
+
+    MPI_Win m_Win = MPI_WIN_NULL;
+};
+
+CommWinImplMPI::~CommWinImplMPI() = default;
+
+void CommWinImplMPI::Free(const std::string &hint)
+{
+    if (m_Win != MPI_WIN_NULL)
+    {
+        CheckMPIReturn(MPI_Win_free(&m_Win), hint);
+    }
+}
+
 class CommImplMPI : public CommImpl
 {
 public:
@@ -146,6 +167,10 @@ public:
     void Bcast(void *buffer, size_t count, Datatype datatype, int root,
                const std::string &hint) const override;
 
+    void Exscan(const void *sendbuf, void *recvbuf, size_t count,
+                Datatype datatype, Comm::Op op,
+                const std::string &hint) const override;
+
     void Gather(const void *sendbuf, size_t sendcount, Datatype sendtype,
                 void *recvbuf, size_t recvcount, Datatype recvtype, int root,
                 const std::string &hint) const override;
@@ -177,6 +202,13 @@ public:
 
     Comm::Req Irecv(void *buffer, size_t count, Datatype datatype, int source,
                     int tag, const std::string &hint) const override;
+
+    Comm::Win Win_allocate_shared(size_t size, int dispUnit, void *baseptr,
+                                  const std::string &hint) const override;
+
+    void Win_shared_query(Comm::Win &win, int rank, size_t *size,
+                          int *dispUnit, void *baseptr,
+                          const std::string &hint) const override;
 };
 
 CommImplMPI::~CommImplMPI()
@@ -319,6 +351,15 @@ void CommImplMPI::Bcast(void *buffer, size_t count, Datatype datatype, int root,
     }
 }
 
+void CommImplMPI::Exscan(const void *sendbuf, void *recvbuf, size_t count,
+                         Datatype datatype, Comm::Op op,
+                         const std::string &hint) const
+{
+    CheckMPIReturn(MPI_Exscan(sendbuf, recvbuf, static_cast<int>(count),
+                              ToMPI(datatype), ToMPI(op), m_MPIComm),
+                   hint);
+}
+
 void CommImplMPI::Gather(const void *sendbuf, size_t sendcount,
                          Datatype sendtype, void *recvbuf, size_t recvcount,
                          Datatype recvtype, int root,
@@ -519,6 +560,30 @@ Comm::Req CommImplMPI::Irecv(void *buffer, size_t count, Datatype datatype,
     return MakeReq(std::move(req));
 }
 
+Comm::Win CommImplMPI::Win_allocate_shared(size_t size, int dispUnit,
+                                           void *baseptr,
+                                           const std::string &hint) const
+{
+    auto win = std::unique_ptr<CommWinImplMPI>(new CommWinImplMPI());
+    CheckMPIReturn(MPI_Win_allocate_shared(static_cast<MPI_Aint>(size),
+                                           dispUnit, MPI_INFO_NULL, m_MPIComm,
+                                           baseptr, &win->m_Win),
+                   hint);
+    return MakeWin(std::move(win));
+}
+
+void CommImplMPI::Win_shared_query(Comm::Win &win, int rank, size_t *size,
+                                   int *dispUnit, void *baseptr,
+                                   const std::string &hint) const
+{
+    CommWinImplMPI *w = dynamic_cast<CommWinImplMPI *>(CommImpl::Get(win));
+    MPI_Aint mpiSize;
+    CheckMPIReturn(
+        MPI_Win_shared_query(w->m_Win, rank, &mpiSize, dispUnit, baseptr),
+        hint);
+    *size = static_cast<size_t>(mpiSize);
+}
+
 Comm::Status CommReqImplMPI::Wait(const std::string &hint)
 {
     Comm::Status status;
@@ -12,13 +12,26 @@
 
 #include <algorithm> //std::transform, std::reverse
 #include <cmath>
+#include <cstring>    //std::memcpy
 #include <functional> //std::minus<T>
 #include <iterator>   //std::back_inserter
+#include <limits>     //std::numeric_limits
 #include <numeric>    //std::accumulate
 #include <utility>    //std::pair
 
 #include "adios2/helper/adiosString.h" //DimsToString
 
+// float/double min/max kernels: AVX and AVX-512 on x86 are compiled with
+// target attributes and selected at runtime, NEON is always there on aarch64
+#if (defined(__x86_64__) || defined(__i386__)) &&                              \
+    (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5))
+#define ADIOS2_HELPER_MINMAX_X86
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define ADIOS2_HELPER_MINMAX_NEON
+#include <arm_neon.h>
+#endif
+
 namespace adios2
 {
 namespace helper
@@ -498,5 +511,212 @@ Box<Dims> GetSubBlock(const Dims &count, const BlockDivisionInfo &info,
     return std::make_pair(sbStart, sbCount);
 }
 
+namespace
+{
+
+/** Scalar part of the min/max kernels, from element begin on, starting from
+ * partial results lmin/lmax. Also the fallback for the whole array. */
+template <class T>
+inline void MinMaxTail(const T *values, const size_t size, const size_t begin,
+                       char *destination, T lmin, T lmax, T &min,
+                       T &max) noexcept
+{
+    for (size_t i = begin; i < size; ++i)
+    {
+        const T value = values[i];
+        if (destination != nullptr)
+        {
+            std::memcpy(destination + i * sizeof(T), &value, sizeof(T));
+        }
+        lmin = value < lmin ? value : lmin;
+        lmax = value > lmax ? value : lmax;
+    }
+
+    if (lmin > lmax) // only NaNs
+    {
+        lmin = values[0];
+        lmax = values[0];
+    }
+    min = lmin;
+    max = lmax;
+}
+
+/*
+ * Two accumulators of WIDTH lanes each. MIN(value, acc) must return acc when
+ * value is NaN (x86 min/max return the second operand, NEON minnm/maxnm the
+ * number), so NaNs are skipped like in GetMinMaxScalar.
+ */
+#define ADIOS2_MINMAX_KERNEL(NAME, TARGET, T, VT, WIDTH, LOAD, STORE, SET1,    \
+                             MIN, MAX)                                         \
+    TARGET void NAME(const T *values, const size_t size, char *destination,    \
+                     T &min, T &max) noexcept                                  \
+    {                                                                          \
+        const T inf = std::numeric_limits<T>::infinity();                      \
+        VT vmin0 = SET1(inf);                                                  \
+        VT vmin1 = vmin0;                                                      \
+        VT vmax0 = SET1(-inf);                                                 \
+        VT vmax1 = vmax0;                                                      \
+                                                                               \
+        const size_t end = size - size % (2 * WIDTH);                          \
+        if (destination == nullptr)                                            \
+        {                                                                      \
+            for (size_t i = 0; i < end; i += 2 * WIDTH)                        \
+            {                                                                  \
+                const VT v0 = LOAD(values + i);                                \
+                const VT v1 = LOAD(values + i + WIDTH);                        \
+                vmin0 = MIN(v0, vmin0);                                        \
+                vmin1 = MIN(v1, vmin1);                                        \
+                vmax0 = MAX(v0, vmax0);                                        \
+                vmax1 = MAX(v1, vmax1);                                        \
+            }                                                                  \
+        }                                                                      \
+        else                                                                   \
+        {                                                                      \
+            for (size_t i = 0; i < end; i += 2 * WIDTH)                        \
+            {                                                                  \
+                const VT v0 = LOAD(values + i);                                \
+                const VT v1 = LOAD(values + i + WIDTH);                        \
+                T *out = reinterpret_cast<T *>(destination + i * sizeof(T));   \
+                STORE(out, v0);                                                \
+                STORE(out + WIDTH, v1);                                        \
+                vmin0 = MIN(v0, vmin0);                                        \
+                vmin1 = MIN(v1, vmin1);                                        \
+                vmax0 = MAX(v0, vmax0);                                        \
+                vmax1 = MAX(v1, vmax1);                                        \
+            }                                                                  \
+        }                                                                      \
+                                                                               \
+        T mins[WIDTH];                                                         \
+        T maxs[WIDTH];                                                         \
+        STORE(mins, MIN(vmin0, vmin1));                                        \
+        STORE(maxs, MAX(vmax0, vmax1));                                        \
+        T lmin = inf;                                                          \
+        T lmax = -inf;                                                         \
+        for (size_t w = 0; w < WIDTH; ++w)                                     \
+        {                                                                      \
+            lmin = mins[w] < lmin ? mins[w] : lmin;                            \
+            lmax = maxs[w] > lmax ? maxs[w] : lmax;                            \
+        }                                                                      \
+        MinMaxTail(values, size, end, destination, lmin, lmax, min, max);      \
+    }
+
+#if defined(ADIOS2_HELPER_MINMAX_X86)
+#define ADIOS2_TARGET_AVX __attribute__((target("avx")))
+#define ADIOS2_TARGET_AVX512 __attribute__((target("avx512f")))
+
+ADIOS2_MINMAX_KERNEL(MinMaxAVX, ADIOS2_TARGET_AVX, float, __m256, 8,
+                     _mm256_loadu_ps, _mm256_storeu_ps, _mm256_set1_ps,
+                     _mm256_min_ps, _mm256_max_ps)
+ADIOS2_MINMAX_KERNEL(MinMaxAVX, ADIOS2_TARGET_AVX, double, __m256d, 4,
+                     _mm256_loadu_pd, _mm256_storeu_pd, _mm256_set1_pd,
+                     _mm256_min_pd, _mm256_max_pd)
+ADIOS2_MINMAX_KERNEL(MinMaxAVX512, ADIOS2_TARGET_AVX512, float, __m512, 16,
+                     _mm512_loadu_ps, _mm512_storeu_ps, _mm512_set1_ps,
+                     _mm512_min_ps, _mm512_max_ps)
+ADIOS2_MINMAX_KERNEL(MinMaxAVX512, ADIOS2_TARGET_AVX512, double, __m512d, 8,
+                     _mm512_loadu_pd, _mm512_storeu_pd, _mm512_set1_pd,
+                     _mm512_min_pd, _mm512_max_pd)
+
+#undef ADIOS2_TARGET_AVX
+#undef ADIOS2_TARGET_AVX512
+
+enum class MinMaxISA
+{
+    Scalar,
+    AVX,
+    AVX512
+};
+
+MinMaxISA GetMinMaxISA() noexcept
+{
+    static const MinMaxISA isa = []() {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+        {
+            return MinMaxISA::AVX512;
+        }
+        if (__builtin_cpu_supports("avx"))
+        {
+            return MinMaxISA::AVX;
+        }
+        return MinMaxISA::Scalar;
+    }();
+    return isa;
+}
+
+template <class T>
+inline void MinMaxDispatch(const T *values, const size_t size,
+                           char *destination, T &min, T &max) noexcept
+{
+    switch (GetMinMaxISA())
+    {
+    case MinMaxISA::AVX512:
+        MinMaxAVX512(values, size, destination, min, max);
+        break;
+    case MinMaxISA::AVX:
+        MinMaxAVX(values, size, destination, min, max);
+        break;
+    default:
+        MinMaxTail(values, size, 0, destination,
+                   std::numeric_limits<T>::infinity(),
+                   -std::numeric_limits<T>::infinity(), min, max);
+    }
+}
+
+#elif defined(ADIOS2_HELPER_MINMAX_NEON)
+#define ADIOS2_TARGET_NEON
+
+ADIOS2_MINMAX_KERNEL(MinMaxNEON, ADIOS2_TARGET_NEON, float, float32x4_t, 4,
+                     vld1q_f32, vst1q_f32, vdupq_n_f32, vminnmq_f32,
+                     vmaxnmq_f32)
+ADIOS2_MINMAX_KERNEL(MinMaxNEON, ADIOS2_TARGET_NEON, double, float64x2_t, 2,
+                     vld1q_f64, vst1q_f64, vdupq_n_f64, vminnmq_f64,
+                     vmaxnmq_f64)
+
+#undef ADIOS2_TARGET_NEON
+
+template <class T>
+inline void MinMaxDispatch(const T *values, const size_t size,
+                           char *destination, T &min, T &max) noexcept
+{
+    MinMaxNEON(values, size, destination, min, max);
+}
+
+#else
+
+template <class T>
+inline void MinMaxDispatch(const T *values, const size_t size,
+                           char *destination, T &min, T &max) noexcept
+{
+    MinMaxTail(values, size, 0, destination,
+               std::numeric_limits<T>::infinity(),
+               -std::numeric_limits<T>::infinity(), min, max);
+}
+#endif
+
+#undef ADIOS2_MINMAX_KERNEL
+
+} // end anonymous namespace
+
+void GetMinMaxVectorized(const float *values, const size_t size,
+                         char *destination, float &min, float &max) noexcept
+{
+    if (size == 0)
+    {
+        return;
+    }
+    MinMaxDispatch(values, size, destination, min, max);
+}
+
+void GetMinMaxVectorized(const double *values, const size_t size,
+                         char *destination, double &min, double &max) noexcept
+{
+    if (size == 0)
+    {
+        return;
+    }
+    MinMaxDispatch(values, size, destination, min, max);
+}
+
 } // end namespace helper
 } // end namespace adios2
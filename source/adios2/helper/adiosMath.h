@@ -47,7 +47,8 @@ void GetMinMaxSelection(const T *values, const Dims &shape, const Dims &start,
 
 /**
  * Gets the min and max from a values array of primitive types (not including
- * complex)
+ * complex). NaN values are ignored, min and max are NaN only if all values are
+ * NaN. float and double use vectorized kernels selected at runtime.
  * @param values input array
  * @param size of values array
  * @param min of values
@@ -56,6 +57,41 @@ void GetMinMaxSelection(const T *values, const Dims &shape, const Dims &start,
 template <class T>
 void GetMinMax(const T *values, const size_t size, T &min, T &max) noexcept;
 
+/**
+ * Portable branch-free version of GetMinMax, same NaN semantics. Fallback of
+ * the vectorized kernels and the implementation for all other primitive types.
+ * @param values input array
+ * @param size of values array
+ * @param min of values
+ * @param max of values
+ */
+template <class T>
+void GetMinMaxScalar(const T *values, const size_t size, T &min,
+                     T &max) noexcept;
+
+/**
+ * Copies values into destination while getting their min and max, so the
+ * data is streamed through the cache only once. Same semantics as GetMinMax.
+ * @param values input array
+ * @param size of values array
+ * @param destination output bytes, like a buffer position in CopyToBuffer it
+ * doesn't need to be aligned for T, must not overlap values
+ * @param min of values
+ * @param max of values
+ */
+template <class T>
+void CopyAndGetMinMax(const T *values, const size_t size, char *destination,
+                      T &min, T &max) noexcept;
+
+/**
+ * Vectorized GetMinMax / CopyAndGetMinMax kernels for float and double, use
+ * the generic templates instead. destination may be nullptr (no copy).
+ */
+void GetMinMaxVectorized(const float *values, const size_t size,
+                         char *destination, float &min, float &max) noexcept;
+void GetMinMaxVectorized(const double *values, const size_t size,
+                         char *destination, double &min, double &max) noexcept;
+
 /**
  * Version for complex types of GetMinMax, gets the "doughnut" range between min
  * and max modulus. Needed a different function as thread can't resolve the
@@ -313,6 +349,22 @@ void GetMinMaxSubblocks(const T *values, const Dims &count,
                         const BlockDivisionInfo &info, std::vector<T> &MinMaxs,
                         T &bmin, T &bmax, const unsigned int threads) noexcept;
 
+/**
+ * Fused version of a contiguous copy and GetMinMaxSubblocks, values are read
+ * only once. Subblocks are split across threads.
+ * @param values input array
+ * @param count N-dims of array
+ * @param info The result of DivideBlock() to help enumerate the sub-blocks
+ * @param destination output bytes as in CopyAndGetMinMax
+ * @param MinMaxs empty vector which will be allocated and filled out (min-max
+ * pairs)
+ */
+template <class T>
+void CopyAndGetMinMaxSubblocks(const T *values, const Dims &count,
+                               const BlockDivisionInfo &info, char *destination,
+                               std::vector<T> &MinMaxs, T &bmin, T &bmax,
+                               const unsigned int threads) noexcept;
+
 } // end namespace helper
 } // end namespace adios2
 
@@ -16,6 +16,7 @@
 
 #include <algorithm> // std::minmax_element, std::min_element, std::max_element
                      // std::transform
+#include <cstring>   // std::memcpy
 #include <limits>    //std::numeri_limits
 #include <thread>
 
@@ -182,13 +183,59 @@ void GetMinMaxSelection(const T *values, const Dims &shape, const Dims &start,
     }
 }
 
+template <class T>
+void GetMinMaxScalar(const T *values, const size_t size, T &min,
+                     T &max) noexcept
+{
+    if (size == 0)
+    {
+        return;
+    }
+
+    // start from the identities so that a NaN never enters the accumulators,
+    // the ternaries below don't select it and the loop vectorizes
+    T lmin = std::numeric_limits<T>::has_infinity
+                 ? std::numeric_limits<T>::infinity()
+                 : std::numeric_limits<T>::max();
+    T lmax = std::numeric_limits<T>::has_infinity
+                 ? -std::numeric_limits<T>::infinity()
+                 : std::numeric_limits<T>::lowest();
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        const T value = values[i];
+        lmin = value < lmin ? value : lmin;
+        lmax = value > lmax ? value : lmax;
+    }
+
+    if (lmin > lmax) // only NaNs
+    {
+        lmin = values[0];
+        lmax = values[0];
+    }
+    min = lmin;
+    max = lmax;
+}
+
 template <class T>
 inline void GetMinMax(const T *values, const size_t size, T &min,
                       T &max) noexcept
 {
-    auto bounds = std::minmax_element(values, values + size);
-    min = *bounds.first;
-    max = *bounds.second;
+    GetMinMaxScalar(values, size, min, max);
+}
+
+template <>
+inline void GetMinMax(const float *values, const size_t size, float &min,
+                      float &max) noexcept
+{
+    GetMinMaxVectorized(values, size, nullptr, min, max);
+}
+
+template <>
+inline void GetMinMax(const double *values, const size_t size, double &min,
+                      double &max) noexcept
+{
+    GetMinMaxVectorized(values, size, nullptr, min, max);
 }
 
 template <>
@@ -207,6 +254,72 @@ inline void GetMinMax(const std::complex<double> *values, const size_t size,
     GetMinMaxComplex(values, size, min, max);
 }
 
+template <class T>
+void CopyAndGetMinMax(const T *values, const size_t size, char *destination,
+                      T &min, T &max) noexcept
+{
+    if (size == 0)
+    {
+        return;
+    }
+
+    T lmin = std::numeric_limits<T>::has_infinity
+                 ? std::numeric_limits<T>::infinity()
+                 : std::numeric_limits<T>::max();
+    T lmax = std::numeric_limits<T>::has_infinity
+                 ? -std::numeric_limits<T>::infinity()
+                 : std::numeric_limits<T>::lowest();
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        const T value = values[i];
+        std::memcpy(destination + i * sizeof(T), &value, sizeof(T));
+        lmin = value < lmin ? value : lmin;
+        lmax = value > lmax ? value : lmax;
+    }
+
+    if (lmin > lmax) // only NaNs
+    {
+        lmin = values[0];
+        lmax = values[0];
+    }
+    min = lmin;
+    max = lmax;
+}
+
+template <>
+inline void CopyAndGetMinMax(const float *values, const size_t size,
+                             char *destination, float &min, float &max) noexcept
+{
+    GetMinMaxVectorized(values, size, destination, min, max);
+}
+
+template <>
+inline void CopyAndGetMinMax(const double *values, const size_t size,
+                             char *destination, double &min,
+                             double &max) noexcept
+{
+    GetMinMaxVectorized(values, size, destination, min, max);
+}
+
+#define declare_template_instantiation(T)                                      \
+    template <>                                                                \
+    inline void CopyAndGetMinMax(const std::complex<T> *values,                \
+                                 const size_t size, char *destination,         \
+                                 std::complex<T> &min,                         \
+                                 std::complex<T> &max) noexcept                \
+    {                                                                          \
+        if (size == 0)                                                         \
+        {                                                                      \
+            return;                                                            \
+        }                                                                      \
+        std::memcpy(destination, values, size * sizeof(std::complex<T>));      \
+        GetMinMaxComplex(values, size, min, max);                              \
+    }
+
+ADIOS2_FOREACH_COMPLEX_PRIMITIVE_TYPE_1ARG(declare_template_instantiation)
+#undef declare_template_instantiation
+
 template <class T>
 void GetMinMaxComplex(const std::complex<T> *values, const size_t size,
                       std::complex<T> &min, std::complex<T> &max) noexcept
@@ -284,11 +397,11 @@ void GetMinMaxThreads(const T *values, const size_t size, T &min, T &max,
         getMinMaxThread.join();
     }
 
-    auto itMin = std::min_element(mins.begin(), mins.end());
-    min = *itMin;
-
-    auto itMax = std::max_element(maxs.begin(), maxs.end());
-    max = *itMax;
+    // a chunk with only NaNs reports NaN, GetMinMax skips it
+    T minTemp;
+    T maxTemp;
+    GetMinMax(mins.data(), mins.size(), min, maxTemp);
+    GetMinMax(maxs.data(), maxs.size(), minTemp, max);
 }
 
 template <class T>
@@ -392,6 +505,7 @@ void GetMinMaxSubblocks(const T *values, const Dims &count,
             GetMinMax(values + pos, nElemsSub, vmin, vmax);
             MinMaxs[2 * b] = vmin;
             MinMaxs[2 * b + 1] = vmax;
+            // bmin != bmin: a previous subblock had only NaNs
             if (b == 0)
             {
                 bmin = vmin;
@@ -399,11 +513,11 @@ void GetMinMaxSubblocks(const T *values, const Dims &count,
             }
             else
             {
-                if (LessThan(vmin, bmin))
+                if (LessThan(vmin, bmin) || bmin != bmin)
                 {
                     bmin = vmin;
                 }
-                if (GreaterThan(vmax, bmax))
+                if (GreaterThan(vmax, bmax) || bmax != bmax)
                 {
                     bmax = vmax;
                 }
@@ -412,6 +526,129 @@ void GetMinMaxSubblocks(const T *values, const Dims &count,
     }
 }
 
+template <class T>
+void CopyAndGetMinMaxSubblocks(const T *values, const Dims &count,
+                               const BlockDivisionInfo &info, char *destination,
+                               std::vector<T> &MinMaxs, T &bmin, T &bmax,
+                               const unsigned int threads) noexcept
+{
+    const int ndim = static_cast<int>(count.size());
+    const size_t nElems = helper::GetTotalSize(count);
+    const size_t nBlocks = info.NBlocks <= 1 ? 1 : info.NBlocks;
+    MinMaxs.resize(2 * nBlocks);
+    if (nElems == 0)
+    {
+        return;
+    }
+
+    // element ranges {start, size} scanned by GetMinMaxSubblocks, a single
+    // block is cut into one range per thread
+    std::vector<std::pair<size_t, size_t>> ranges;
+    if (nBlocks == 1)
+    {
+        const size_t nRanges =
+            (threads <= 1 || nElems < 1000000) ? 1 : threads;
+        for (size_t r = 0; r < nRanges; ++r)
+        {
+            const size_t start = nElems * r / nRanges;
+            ranges.emplace_back(start, nElems * (r + 1) / nRanges - start);
+        }
+    }
+    else
+    {
+        ranges.reserve(nBlocks);
+        for (size_t b = 0; b < nBlocks; ++b)
+        {
+            const Box<Dims> box =
+                GetSubBlock(count, info, static_cast<unsigned int>(b));
+            size_t pos = 0;
+            size_t prod = 1;
+            for (int d = ndim - 1; d >= 0; --d)
+            {
+                pos += box.first[d] * prod;
+                prod *= count[d];
+            }
+            ranges.emplace_back(pos, helper::GetTotalSize(box.second));
+        }
+    }
+
+    // the ranges cover the block only if it's divided along the slowest
+    // dimension, otherwise copy and scan separately
+    size_t next = 0;
+    for (const auto &range : ranges)
+    {
+        if (range.first != next)
+        {
+            break;
+        }
+        next += range.second;
+    }
+    if (next != nElems)
+    {
+        std::memcpy(destination, values, nElems * sizeof(T));
+        GetMinMaxSubblocks(values, count, info, MinMaxs, bmin, bmax, threads);
+        return;
+    }
+
+    std::vector<T> rangeMinMaxs(2 * ranges.size());
+    auto lf_CopyRanges = [&](const size_t first, const size_t last) {
+        for (size_t r = first; r < last; ++r)
+        {
+            const size_t pos = ranges[r].first;
+            CopyAndGetMinMax(values + pos, ranges[r].second,
+                             destination + pos * sizeof(T), rangeMinMaxs[2 * r],
+                             rangeMinMaxs[2 * r + 1]);
+        }
+    };
+
+    const size_t nThreads =
+        nElems < 1000000 ? 1 : std::min<size_t>(threads, ranges.size());
+    if (nThreads <= 1)
+    {
+        lf_CopyRanges(0, ranges.size());
+    }
+    else
+    {
+        std::vector<std::thread> copyThreads;
+        copyThreads.reserve(nThreads);
+        for (size_t t = 0; t < nThreads; ++t)
+        {
+            copyThreads.emplace_back(lf_CopyRanges,
+                                     ranges.size() * t / nThreads,
+                                     ranges.size() * (t + 1) / nThreads);
+        }
+        for (auto &copyThread : copyThreads)
+        {
+            copyThread.join();
+        }
+    }
+
+    // bmin != bmin: a previous range had only NaNs
+    bmin = rangeMinMaxs[0];
+    bmax = rangeMinMaxs[1];
+    for (size_t r = 1; r < ranges.size(); ++r)
+    {
+        if (LessThan(rangeMinMaxs[2 * r], bmin) || bmin != bmin)
+        {
+            bmin = rangeMinMaxs[2 * r];
+        }
+        if (GreaterThan(rangeMinMaxs[2 * r + 1], bmax) || bmax != bmax)
+        {
+            bmax = rangeMinMaxs[2 * r + 1];
+        }
+    }
+
+    if (nBlocks == 1)
+    {
+        MinMaxs[0] = bmin;
+        MinMaxs[1] = bmax;
+    }
+    else
+    {
+        MinMaxs = std::move(rangeMinMaxs);
+    }
+}
+
 #if 0
 template <class T>
 void GetMinMaxSubblocks(const T *values, const Dims &count,
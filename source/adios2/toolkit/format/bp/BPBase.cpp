@@ -222,6 +222,11 @@ void BPBase::Init(const Params &parameters, const std::string hint,
             parsedParameters.StreamReader = helper::StringTo<bool>(
                 value, " in Parameter key=StreamReader " + hint);
         }
+        else if (key == "lazymetadata")
+        {
+            parsedParameters.LazyMetadata = helper::StringTo<bool>(
+                value, " in Parameter key=LazyMetadata " + hint);
+        }
     }
     if (!engineType.empty())
     {
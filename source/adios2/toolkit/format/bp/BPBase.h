@@ -216,6 +216,11 @@ public:
          */
         bool StreamReader = false;
 
+        /** Lazy metadata flag (BP4 reader): variables are defined from their
+         * first step only, the rest of their index is parsed on first access
+         */
+        bool LazyMetadata = false;
+
         /** Number of aggregators.
          * Must be a value between 1 and number of MPI ranks
          * 0 as default means that the engine must define the number of
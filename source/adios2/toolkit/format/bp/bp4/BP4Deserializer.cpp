@@ -42,6 +42,8 @@ size_t BP4Deserializer::ParseMetadata(const BufferSTL &bufferSTL,
                                       const bool firstStep)
 {
     const size_t oldSteps = (firstStep ? 0 : m_MetadataSet.StepsCount);
+    // entries refer to the previous content of the metadata buffer
+    m_DeferredVariableIndex.clear();
     size_t allSteps = m_MetadataIndexTable[0].size();
     m_MetadataSet.StepsCount = allSteps;
     m_MetadataSet.CurrentStep = allSteps - 1;
@@ -61,22 +63,251 @@ size_t BP4Deserializer::ParseMetadata(const BufferSTL &bufferSTL,
             selectedSteps.push_back(std::stoi(item));
         }
     }
+    std::vector<size_t> steps;
     for (size_t i = oldSteps; i < allSteps; i++)
     {
         if (selectedSteps.size() == 0 ||
             std::find(selectedSteps.begin(), selectedSteps.end(), i) !=
                 selectedSteps.end())
         {
-            ParsePGIndexPerStep(bufferSTL, engine.m_IO.m_HostLanguage, 0,
-                                i + 1);
-            ParseVariablesIndexPerStep(bufferSTL, engine, 0, i + 1);
-            ParseAttributesIndexPerStep(bufferSTL, engine, 0, i + 1);
-            lastposition = m_MetadataIndexTable[0][i + 1][3];
+            steps.push_back(i);
         }
     }
+
+    if (m_Parameters.Threads > 1 && !m_Parameters.LazyMetadata &&
+        !steps.empty())
+    {
+        return ParseMetadataThreaded(bufferSTL, engine, steps);
+    }
+
+    for (const size_t i : steps)
+    {
+        ParsePGIndexPerStep(bufferSTL, engine.m_IO.m_HostLanguage, 0, i + 1);
+        ParseVariablesIndexPerStep(bufferSTL, engine, 0, i + 1);
+        ParseAttributesIndexPerStep(bufferSTL, engine, 0, i + 1);
+        lastposition = m_MetadataIndexTable[0][i + 1][3];
+    }
     return lastposition;
 }
 
+size_t BP4Deserializer::ParseMetadataThreaded(const BufferSTL &bufferSTL,
+                                              core::Engine &engine,
+                                              const std::vector<size_t> &steps)
+{
+    const auto &buffer = bufferSTL.m_Buffer;
+
+    // start positions of all variable index elements, step by step
+    std::vector<size_t> elementPositions;
+    std::vector<size_t> stepFirstElement;
+    stepFirstElement.reserve(steps.size() + 1);
+    for (const size_t i : steps)
+    {
+        stepFirstElement.push_back(elementPositions.size());
+
+        size_t position = m_MetadataIndexTable[0][i + 1][1];
+        // skip count
+        helper::ReadValue<uint32_t>(buffer, position,
+                                    m_Minifooter.IsLittleEndian);
+        const uint64_t length = helper::ReadValue<uint64_t>(
+            buffer, position, m_Minifooter.IsLittleEndian);
+
+        const size_t startPosition = position;
+        while (position - startPosition < length)
+        {
+            elementPositions.push_back(position);
+            const size_t elementIndexSize =
+                static_cast<size_t>(helper::ReadValue<uint32_t>(
+                    buffer, position, m_Minifooter.IsLittleEndian));
+            position += elementIndexSize;
+        }
+    }
+    stepFirstElement.push_back(elementPositions.size());
+
+    // phase 1: decode the elements in parallel, contiguous chunk per thread
+    const size_t elements = elementPositions.size();
+    std::vector<std::unique_ptr<StagedVariableIndex>> staged(elements);
+
+    auto lf_StageElements = [&](const size_t begin, const size_t end) {
+        for (size_t e = begin; e < end; ++e)
+        {
+            staged[e] = StageVariableIndex(buffer, elementPositions[e]);
+        }
+    };
+
+    const size_t threads =
+        std::max(static_cast<size_t>(1),
+                 std::min(static_cast<size_t>(m_Parameters.Threads), elements));
+    const size_t chunk = elements / threads;
+    const size_t remainder = elements % threads;
+
+    std::vector<std::future<void>> asyncs;
+    asyncs.reserve(threads - 1);
+    size_t begin = chunk + (remainder > 0 ? 1 : 0);
+    for (size_t t = 1; t < threads; ++t)
+    {
+        const size_t end = begin + chunk + (t < remainder ? 1 : 0);
+        asyncs.push_back(
+            std::async(std::launch::async, lf_StageElements, begin, end));
+        begin = end;
+    }
+    lf_StageElements(0, chunk + (remainder > 0 ? 1 : 0));
+
+    for (auto &async : asyncs)
+    {
+        async.get();
+    }
+
+    // phase 2: register in step order, DefineVariable isn't thread-safe
+    size_t lastposition = 0;
+    for (size_t s = 0; s < steps.size(); ++s)
+    {
+        const size_t i = steps[s];
+        ParsePGIndexPerStep(bufferSTL, engine.m_IO.m_HostLanguage, 0, i + 1);
+        for (size_t e = stepFirstElement[s]; e < stepFirstElement[s + 1]; ++e)
+        {
+            DefineStagedVariable(*staged[e], engine, i + 1);
+            staged[e].reset();
+        }
+        ParseAttributesIndexPerStep(bufferSTL, engine, 0, i + 1);
+        lastposition = m_MetadataIndexTable[0][i + 1][3];
+    }
+    return lastposition;
+}
+
+std::unique_ptr<BP4Deserializer::StagedVariableIndex>
+BP4Deserializer::StageVariableIndex(const std::vector<char> &buffer,
+                                    size_t position) const
+{
+    const ElementIndexHeader header =
+        ReadElementIndexHeader(buffer, position, m_Minifooter.IsLittleEndian);
+
+    std::unique_ptr<StagedVariableIndex> staged;
+    switch (header.DataType)
+    {
+
+#define make_case(T)                                                           \
+    case (TypeTraits<T>::type_enum):                                           \
+    {                                                                          \
+        std::unique_ptr<StagedVariableIndexOf<T>> stagedT(                     \
+            new StagedVariableIndexOf<T>());                                   \
+        stagedT->Blocks =                                                      \
+            ReadVariableIndexBlocks<T>(header, buffer, position);              \
+        staged = std::move(stagedT);                                           \
+        break;                                                                 \
+    }
+        ADIOS2_FOREACH_STDTYPE_1ARG(make_case)
+#undef make_case
+
+    default:
+        // unsupported types are skipped, as in ParseVariablesIndexPerStep
+        staged.reset(new StagedVariableIndex());
+        break;
+    } // end switch
+
+    staged->Header = header;
+    staged->Position = position;
+    return staged;
+}
+
+void BP4Deserializer::DeferVariableIndexPerStep(
+    const ElementIndexHeader &header, core::VariableBase &variable,
+    const std::vector<char> &buffer, const size_t elementPosition,
+    size_t position, const size_t step)
+{
+    const size_t endPosition =
+        elementPosition + static_cast<size_t>(header.Length) + 4;
+
+    // each block is characteristics count (1 byte), length (4 bytes), data
+    std::vector<size_t> &blockOffsets =
+        variable.m_AvailableStepBlockIndexOffsets[step];
+    while (position < endPosition)
+    {
+        blockOffsets.push_back(position);
+        size_t lengthPosition = position + 1;
+        const uint32_t length = helper::ReadValue<uint32_t>(
+            buffer, lengthPosition, m_Minifooter.IsLittleEndian);
+        position = lengthPosition + length;
+    }
+
+    ++variable.m_AvailableStepsCount;
+    variable.m_DeferredMetadata = true;
+    m_DeferredVariableIndex[variable.m_Name].emplace_back(step,
+                                                          elementPosition);
+}
+
+void BP4Deserializer::LoadDeferredVariableIndex(core::VariableBase &variable,
+                                                core::Engine &engine)
+{
+    variable.m_DeferredMetadata = false;
+    auto itDeferred = m_DeferredVariableIndex.find(variable.m_Name);
+    if (itDeferred == m_DeferredVariableIndex.end())
+    {
+        return;
+    }
+    const std::vector<std::pair<size_t, size_t>> elements =
+        std::move(itDeferred->second);
+    m_DeferredVariableIndex.erase(itDeferred);
+
+    // same as a full ParseMetadata, see ProcessNextStepInMemory in BP4Reader
+    const bool saveReadStreaming = engine.m_IO.m_ReadStreaming;
+    engine.m_IO.m_ReadStreaming = false;
+
+    const auto &buffer = m_Metadata.m_Buffer;
+    for (const auto &element : elements)
+    {
+        const size_t step = element.first;
+        size_t position = element.second;
+
+        // the step is counted again by DefineVariableInEngineIOPerStep
+        variable.m_AvailableStepBlockIndexOffsets[step].clear();
+        --variable.m_AvailableStepsCount;
+
+        const ElementIndexHeader header = ReadElementIndexHeader(
+            buffer, position, m_Minifooter.IsLittleEndian);
+
+        switch (header.DataType)
+        {
+
+#define make_case(T)                                                           \
+    case (TypeTraits<T>::type_enum):                                           \
+    {                                                                          \
+        DefineVariableInEngineIOPerStep<T>(header, engine, buffer, position,   \
+                                           step);                              \
+        break;                                                                 \
+    }
+            ADIOS2_FOREACH_STDTYPE_1ARG(make_case)
+#undef make_case
+
+        } // end switch
+    }
+
+    engine.m_IO.m_ReadStreaming = saveReadStreaming;
+}
+
+void BP4Deserializer::DefineStagedVariable(const StagedVariableIndex &staged,
+                                           core::Engine &engine,
+                                           size_t step) const
+{
+    switch (staged.Header.DataType)
+    {
+
+#define make_case(T)                                                           \
+    case (TypeTraits<T>::type_enum):                                           \
+    {                                                                          \
+        DefineVariableInEngineIOPerStep<T>(                                    \
+            staged.Header, engine,                                             \
+            static_cast<const StagedVariableIndexOf<T> &>(staged).Blocks,      \
+            staged.Position, step);                                            \
+        break;                                                                 \
+    }
+        ADIOS2_FOREACH_STDTYPE_1ARG(make_case)
+#undef make_case
+
+    default:
+        break;
+    } // end switch
+}
+
 void BP4Deserializer::ParseMetadataIndex(BufferSTL &bufferSTL,
                                          const size_t absoluteStartPos,
                                          const bool hasHeader,
@@ -313,9 +544,26 @@ void BP4Deserializer::ParseVariablesIndexPerStep(const BufferSTL &bufferSTL,
     auto lf_ReadElementIndexPerStep = [&](core::Engine &engine,
                                           const std::vector<char> &buffer,
                                           size_t position, size_t step) {
+        const size_t elementPosition = position;
         const ElementIndexHeader header = ReadElementIndexHeader(
             buffer, position, m_Minifooter.IsLittleEndian);
 
+        if (m_Parameters.LazyMetadata)
+        {
+            // only the first step of a variable is parsed now
+            const std::string variableName =
+                header.Path.empty() ? header.Name
+                                    : header.Path + PathSeparator + header.Name;
+            const core::VarMap &variables = engine.m_IO.GetVariables();
+            auto itVariable = variables.find(variableName);
+            if (itVariable != variables.end())
+            {
+                DeferVariableIndexPerStep(header, *itVariable->second, buffer,
+                                          elementPosition, position, step);
+                return;
+            }
+        }
+
         switch (header.DataType)
         {
 
@@ -343,66 +591,17 @@ void BP4Deserializer::ParseVariablesIndexPerStep(const BufferSTL &bufferSTL,
     const size_t startPosition = position;
     size_t localPosition = 0;
 
-    /* FIXME: multi-threaded processing does not work here
-     * because DefineVariable may be called from several threads
-     */
-    /*if (m_Threads == 1)*/
+    // see ParseMetadataThreaded for the multi-threaded version
+    while (localPosition < length)
     {
-        while (localPosition < length)
-        {
-            lf_ReadElementIndexPerStep(engine, buffer, position, step);
+        lf_ReadElementIndexPerStep(engine, buffer, position, step);
 
-            const size_t elementIndexSize =
-                static_cast<size_t>(helper::ReadValue<uint32_t>(
-                    buffer, position, m_Minifooter.IsLittleEndian));
-            position += elementIndexSize;
-            localPosition = position - startPosition;
-        }
-        return;
+        const size_t elementIndexSize =
+            static_cast<size_t>(helper::ReadValue<uint32_t>(
+                buffer, position, m_Minifooter.IsLittleEndian));
+        position += elementIndexSize;
+        localPosition = position - startPosition;
     }
-    /*
-        // threads for reading Variables
-        std::vector<std::future<void>> asyncs(m_Threads);
-        std::vector<size_t> asyncPositions(m_Threads);
-
-        bool launched = false;
-
-        while (localPosition < length)
-        {
-            // extract async positions
-            for (unsigned int t = 0; t < m_Threads; ++t)
-            {
-                asyncPositions[t] = position;
-                const size_t elementIndexSize =
-                    static_cast<size_t>(helper::ReadValue<uint32_t>(
-                        buffer, position, m_Minifooter.IsLittleEndian));
-                position += elementIndexSize;
-                localPosition = position - startPosition;
-
-                if (launched)
-                {
-                    asyncs[t].get();
-                }
-
-                if (localPosition <= length)
-                {
-                    asyncs[t] =
-                        std::async(std::launch::async,
-       lf_ReadElementIndexPerStep, std::ref(engine), std::ref(buffer),
-                                   asyncPositions[t], step);
-                }
-            }
-            launched = true;
-        }
-
-        for (auto &async : asyncs)
-        {
-            if (async.valid())
-            {
-                async.wait();
-            }
-        }
-    */
 }
 
 /* void BP4Deserializer::ParseVariablesIndex(const BufferSTL &bufferSTL,
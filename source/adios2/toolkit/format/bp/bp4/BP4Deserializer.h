@@ -15,8 +15,10 @@
 
 #include "BP4Base.h"
 
+#include <memory> //std::unique_ptr
 #include <mutex>
 #include <set>
+#include <unordered_map>
 #include <utility> //std::pair
 #include <vector>
 
@@ -58,6 +60,15 @@ public:
     size_t ParseMetadata(const BufferSTL &bufferSTL, core::Engine &engine,
                          const bool firstStep = true);
 
+    /**
+     * Parses the variable index elements skipped by ParseMetadata with
+     * LazyMetadata=true, they are read from m_Metadata
+     * @param variable with m_DeferredMetadata set
+     * @param engine reader engine owning the variable
+     */
+    void LoadDeferredVariableIndex(core::VariableBase &variable,
+                                   core::Engine &engine);
+
     /**
      * Used to get the variable payload data for the current selection (dims and
      * steps), used in single buffer for streaming
@@ -185,6 +196,11 @@ public:
 private:
     std::map<std::string, helper::SubFileInfoMap> m_DeferredVariablesMap;
 
+    /** LazyMetadata: variable name -> (step, variable index element start in
+     * m_Metadata) of the elements not yet parsed */
+    std::unordered_map<std::string, std::vector<std::pair<size_t, size_t>>>
+        m_DeferredVariableIndex;
+
     static std::mutex m_Mutex;
 
     void ParseMinifooter(const BufferSTL &bufferSTL);
@@ -204,6 +220,75 @@ private:
                                      core::Engine &engine,
                                      size_t submetadatafileId, size_t step);
 
+    /** One block of a variable index element, decoded from the metadata */
+    template <class T>
+    struct VariableIndexBlock
+    {
+        size_t Position; // of the block characteristics in the metadata
+        Characteristics<T> BlockCharacteristics;
+    };
+
+    /**
+     * A variable index element of one step, decoded by a worker thread in the
+     * first phase of a threaded ParseMetadata. The second phase registers it
+     * with the IO on a single thread (DefineVariable isn't thread-safe).
+     */
+    struct StagedVariableIndex
+    {
+        ElementIndexHeader Header;
+        size_t Position; // right after the element header
+        virtual ~StagedVariableIndex() = default;
+    };
+
+    template <class T>
+    struct StagedVariableIndexOf : public StagedVariableIndex
+    {
+        std::vector<VariableIndexBlock<T>> Blocks;
+    };
+
+    /**
+     * Threaded version of ParseMetadata for steps [firstStep, lastStep), all
+     * variable index elements are decoded first, then registered in order.
+     * @return position in the buffer where processing ends
+     */
+    size_t ParseMetadataThreaded(const BufferSTL &bufferSTL,
+                                 core::Engine &engine,
+                                 const std::vector<size_t> &steps);
+
+    /**
+     * LazyMetadata: records the blocks of an element of an already defined
+     * variable without decoding their characteristics
+     * @param header element header
+     * @param variable defined in a previous step
+     * @param elementPosition start of the element (before the header)
+     * @param position right after the element header
+     * @param step
+     */
+    void DeferVariableIndexPerStep(const ElementIndexHeader &header,
+                                   core::VariableBase &variable,
+                                   const std::vector<char> &buffer,
+                                   const size_t elementPosition,
+                                   size_t position, const size_t step);
+
+    /** Decode the variable index element starting at position */
+    std::unique_ptr<StagedVariableIndex>
+    StageVariableIndex(const std::vector<char> &buffer, size_t position) const;
+
+    void DefineStagedVariable(const StagedVariableIndex &staged,
+                              core::Engine &engine, size_t step) const;
+
+    /**
+     * Decode all blocks of a variable index element
+     * @param header element header
+     * @param buffer metadata
+     * @param position right after the element header
+     */
+    template <class T>
+    std::vector<VariableIndexBlock<T>>
+    ReadVariableIndexBlocks(const ElementIndexHeader &header,
+                            const std::vector<char> &buffer,
+                            size_t position) const;
+
     /**
      * Reads a variable index element (serialized) and calls IO.DefineVariable
      * to deserialize the Variable metadata
@@ -219,6 +304,14 @@ private:
                                          const std::vector<char> &buffer,
                                          size_t position, size_t step) const;
 
+    /** Registers a variable index element decoded by ReadVariableIndexBlocks,
+     * position is right after the element header */
+    template <class T>
+    void DefineVariableInEngineIOPerStep(
+        const ElementIndexHeader &header, core::Engine &engine,
+        const std::vector<VariableIndexBlock<T>> &blocks, size_t position,
+        size_t step) const;
+
     template <class T>
     void DefineAttributeInEngineIO(const ElementIndexHeader &header,
                                    core::Engine &engine,
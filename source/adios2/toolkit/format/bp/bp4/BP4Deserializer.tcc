@@ -624,14 +624,13 @@ void BP4Deserializer::ClipContiguousMemory(
 template <>
 inline void BP4Deserializer::DefineVariableInEngineIOPerStep<std::string>(
     const ElementIndexHeader &header, core::Engine &engine,
-    const std::vector<char> &buffer, size_t position, size_t step) const
+    const std::vector<VariableIndexBlock<std::string>> &blocks,
+    size_t position, size_t step) const
 {
     const size_t initialPosition = position;
 
-    const Characteristics<std::string> characteristics =
-        ReadElementIndexCharacteristics<std::string>(
-            buffer, position, static_cast<DataTypes>(header.DataType), false,
-            m_Minifooter.IsLittleEndian);
+    const Characteristics<std::string> &characteristics =
+        blocks.front().BlockCharacteristics;
 
     const std::string variableName =
         header.Path.empty() ? header.Name
@@ -646,20 +645,19 @@ inline void BP4Deserializer::DefineVariableInEngineIOPerStep<std::string>(
             (header.Name.size() + header.GroupName.size() + header.Path.size() +
              23) +
             static_cast<size_t>(header.Length) + 4;
-        position = initialPosition;
         // variable->m_AvailableStepsCount = step;
         ++variable->m_AvailableStepsCount;
         // std::cout << variable->m_Name << ", " <<
         // variable->m_AvailableStepsCount << std::endl;
-        while (position < endPositionCurrentStep)
+        for (const auto &block : blocks)
         {
-            const size_t subsetPosition = position;
-
-            // read until step is found
-            const Characteristics<std::string> subsetCharacteristics =
-                ReadElementIndexCharacteristics<std::string>(
-                    buffer, position, static_cast<DataTypes>(header.DataType),
-                    false, m_Minifooter.IsLittleEndian);
+            const size_t subsetPosition = block.Position;
+            if (subsetPosition >= endPositionCurrentStep)
+            {
+                break;
+            }
+            const Characteristics<std::string> &subsetCharacteristics =
+                block.BlockCharacteristics;
 
             if (subsetCharacteristics.EntryShapeID == ShapeID::LocalValue)
             {
@@ -678,7 +676,6 @@ inline void BP4Deserializer::DefineVariableInEngineIOPerStep<std::string>(
 
             variable->m_AvailableStepBlockIndexOffsets[step].push_back(
                 subsetPosition);
-            position = subsetPosition + subsetCharacteristics.EntryLength + 5;
         }
         return;
     }
@@ -713,20 +710,18 @@ inline void BP4Deserializer::DefineVariableInEngineIOPerStep<std::string>(
     const size_t endPosition =
         variable->m_IndexStart + static_cast<size_t>(header.Length) + 4;
 
-    position = initialPosition;
-
     size_t currentStep = 0; // Starts at 1 in bp file
     std::set<uint32_t> stepsFound;
     variable->m_AvailableStepsCount = 0;
-    while (position < endPosition)
+    for (const auto &block : blocks)
     {
-        const size_t subsetPosition = position;
-
-        // read until step is found
-        const Characteristics<std::string> subsetCharacteristics =
-            ReadElementIndexCharacteristics<std::string>(
-                buffer, position, static_cast<DataTypes>(header.DataType),
-                false, m_Minifooter.IsLittleEndian);
+        const size_t subsetPosition = block.Position;
+        if (subsetPosition >= endPosition)
+        {
+            break;
+        }
+        const Characteristics<std::string> &subsetCharacteristics =
+            block.BlockCharacteristics;
 
         const bool isNextStep =
             stepsFound.insert(subsetCharacteristics.Statistics.Step).second;
@@ -754,7 +749,6 @@ inline void BP4Deserializer::DefineVariableInEngineIOPerStep<std::string>(
 
         variable->m_AvailableStepBlockIndexOffsets[currentStep].push_back(
             subsetPosition);
-        position = subsetPosition + subsetCharacteristics.EntryLength + 5;
     }
 
     if (variable->m_ShapeID == ShapeID::LocalValue)
@@ -773,14 +767,13 @@ inline void BP4Deserializer::DefineVariableInEngineIOPerStep<std::string>(
 template <class T>
 void BP4Deserializer::DefineVariableInEngineIOPerStep(
     const ElementIndexHeader &header, core::Engine &engine,
-    const std::vector<char> &buffer, size_t position, size_t step) const
+    const std::vector<VariableIndexBlock<T>> &blocks, size_t position,
+    size_t step) const
 {
     const size_t initialPosition = position;
 
-    const Characteristics<T> characteristics =
-        ReadElementIndexCharacteristics<T>(
-            buffer, position, static_cast<DataTypes>(header.DataType), false,
-            m_Minifooter.IsLittleEndian);
+    const Characteristics<T> &characteristics =
+        blocks.front().BlockCharacteristics;
 
     const std::string variableName =
         header.Path.empty() ? header.Name
@@ -800,18 +793,17 @@ void BP4Deserializer::DefineVariableInEngineIOPerStep(
             (header.Name.size() + header.GroupName.size() + header.Path.size() +
              23) +
             static_cast<size_t>(header.Length) + 4;
-        position = initialPosition;
         // variable->m_AvailableStepsCount = step;
         ++variable->m_AvailableStepsCount;
-        while (position < endPositionCurrentStep)
+        for (const auto &block : blocks)
         {
-            const size_t subsetPosition = position;
-
-            // read until step is found
-            const Characteristics<T> subsetCharacteristics =
-                ReadElementIndexCharacteristics<T>(
-                    buffer, position, static_cast<DataTypes>(header.DataType),
-                    false, m_Minifooter.IsLittleEndian);
+            const size_t subsetPosition = block.Position;
+            if (subsetPosition >= endPositionCurrentStep)
+            {
+                break;
+            }
+            const Characteristics<T> &subsetCharacteristics =
+                block.BlockCharacteristics;
 
             const T blockMin = characteristics.Statistics.IsValue
                                    ? subsetCharacteristics.Statistics.Value
@@ -859,7 +851,6 @@ void BP4Deserializer::DefineVariableInEngineIOPerStep(
 
             variable->m_AvailableStepBlockIndexOffsets[step].push_back(
                 subsetPosition);
-            position = subsetPosition + subsetCharacteristics.EntryLength + 5;
         }
         return;
     }
@@ -930,20 +921,18 @@ void BP4Deserializer::DefineVariableInEngineIOPerStep(
     const size_t endPosition =
         variable->m_IndexStart + static_cast<size_t>(header.Length) + 4;
 
-    position = initialPosition;
-
     size_t currentStep = 0; // Starts at 1 in bp file
     std::set<uint32_t> stepsFound;
     variable->m_AvailableStepsCount = 0;
-    while (position < endPosition)
+    for (const auto &block : blocks)
     {
-        const size_t subsetPosition = position;
-
-        // read until step is found
-        const Characteristics<T> subsetCharacteristics =
-            ReadElementIndexCharacteristics<T>(
-                buffer, position, static_cast<DataTypes>(header.DataType),
-                false, m_Minifooter.IsLittleEndian);
+        const size_t subsetPosition = block.Position;
+        if (subsetPosition >= endPosition)
+        {
+            break;
+        }
+        const Characteristics<T> &subsetCharacteristics =
+            block.BlockCharacteristics;
 
         const T blockMin = characteristics.Statistics.IsValue
                                ? subsetCharacteristics.Statistics.Value
@@ -1004,7 +993,6 @@ void BP4Deserializer::DefineVariableInEngineIOPerStep(
 
         variable->m_AvailableStepBlockIndexOffsets[currentStep].push_back(
             subsetPosition);
-        position = subsetPosition + subsetCharacteristics.EntryLength + 5;
     }
 
     if (variable->m_ShapeID == ShapeID::LocalValue)
@@ -1021,6 +1009,44 @@ void BP4Deserializer::DefineVariableInEngineIOPerStep(
     variable->m_Engine = &engine;
 }
 
+template <class T>
+std::vector<BP4Deserializer::VariableIndexBlock<T>>
+BP4Deserializer::ReadVariableIndexBlocks(const ElementIndexHeader &header,
+                                         const std::vector<char> &buffer,
+                                         size_t position) const
+{
+    const size_t endPosition =
+        position -
+        (header.Name.size() + header.GroupName.size() + header.Path.size() +
+         23) +
+        static_cast<size_t>(header.Length) + 4;
+
+    std::vector<VariableIndexBlock<T>> blocks;
+    // the first block is always there, it defines the variable
+    do
+    {
+        const size_t blockPosition = position;
+        blocks.push_back(
+            {blockPosition, ReadElementIndexCharacteristics<T>(
+                                buffer, position,
+                                static_cast<DataTypes>(header.DataType), false,
+                                m_Minifooter.IsLittleEndian)});
+        position =
+            blockPosition + blocks.back().BlockCharacteristics.EntryLength + 5;
+    } while (position < endPosition);
+    return blocks;
+}
+
+template <class T>
+void BP4Deserializer::DefineVariableInEngineIOPerStep(
+    const ElementIndexHeader &header, core::Engine &engine,
+    const std::vector<char> &buffer, size_t position, size_t step) const
+{
+    DefineVariableInEngineIOPerStep<T>(
+        header, engine, ReadVariableIndexBlocks<T>(header, buffer, position),
+        position, step);
+}
+
 template <class T>
 void BP4Deserializer::DefineAttributeInEngineIO(
     const ElementIndexHeader &header, core::Engine &engine,
@@ -137,6 +137,10 @@ public:
                                      const bool inMetadataBuffer);
 
 private:
+    /* True between PutVariableMetadata() and PutVariablePayload() if the
+     * payload was already copied into m_Data by PutPayloadWithStats() */
+    bool m_PayloadInBuffer = false;
+
     std::vector<char> m_SerializedIndices;
     std::vector<char> m_GatheredSerializedIndices;
 
@@ -193,12 +197,27 @@ private:
      * Get variable statistics
      * @param variable
      * @param isRowMajor
+     * @param payloadStats only size MinMaxs, values are computed by
+     * PutPayloadWithStats
      * @return stats BP4 Stats
      */
     template <class T>
     Stats<T> GetBPStats(const bool singleValue,
                         const typename core::Variable<T>::BPInfo &blockInfo,
-                        const bool isRowMajor) noexcept;
+                        const bool isRowMajor,
+                        const bool payloadStats = false) noexcept;
+
+    /**
+     * Copies a contiguous block payload into m_Data at the current position
+     * while computing its subblock min/max into stats, so the user array is
+     * read only once. Position is not advanced, PutVariablePayload does it.
+     * @param blockInfo
+     * @param stats with SubBlockInfo from GetBPStats
+     */
+    template <class T>
+    void
+    PutPayloadWithStats(const typename core::Variable<T>::BPInfo &blockInfo,
+                        Stats<T> &stats) noexcept;
 
     /** @return The position that holds the length of the variable entry
      * (metadat+data length). The actual lengths is know after
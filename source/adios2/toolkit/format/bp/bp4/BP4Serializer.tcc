@@ -50,8 +50,15 @@ inline void BP4Serializer::PutVariableMetadata(
 
     m_Profiler.Start("buffering");
 
-    Stats<T> stats =
-        GetBPStats<T>(variable.m_SingleValue, blockInfo, sourceRowMajor);
+    // contiguous payloads without operations are copied here, with the
+    // min/max computed on the way, instead of in PutVariablePayload
+    const bool payloadStats =
+        m_Parameters.StatsLevel > 0 && !variable.m_SingleValue &&
+        span == nullptr && blockInfo.Data != nullptr &&
+        blockInfo.MemoryStart.empty() && blockInfo.Operations.empty();
+
+    Stats<T> stats = GetBPStats<T>(variable.m_SingleValue, blockInfo,
+                                   sourceRowMajor, payloadStats);
 
     // Get new Index or point to existing index
     bool isNew = true; // flag to check if variable is new
@@ -62,8 +69,19 @@ inline void BP4Serializer::PutVariableMetadata(
     stats.MemberID = variableIndex.MemberID;
 
     lf_SetOffset(stats.Offset);
+    const size_t mdPosition = m_Data.m_Position;
+    const size_t mdAbsolutePosition = m_Data.m_AbsolutePosition;
     m_LastVarLengthPosInBuffer =
         PutVariableMetadataInData(variable, blockInfo, stats, span);
+    if (payloadStats)
+    {
+        // the metadata length doesn't depend on the min/max values, write it
+        // again once the payload behind it gave them
+        PutPayloadWithStats(blockInfo, stats);
+        m_Data.m_Position = mdPosition;
+        m_Data.m_AbsolutePosition = mdAbsolutePosition;
+        PutVariableMetadataInData(variable, blockInfo, stats, span);
+    }
     lf_SetOffset(stats.PayloadOffset);
     if (span != nullptr)
     {
@@ -111,7 +129,16 @@ inline void BP4Serializer::PutVariablePayload(
         return;
     }
 
-    if (blockInfo.Operations.empty())
+    if (m_PayloadInBuffer)
+    {
+        // copied by PutVariableMetadata
+        const size_t payloadSize =
+            helper::GetTotalSize(blockInfo.Count) * sizeof(T);
+        m_Data.m_Position += payloadSize;
+        m_Data.m_AbsolutePosition += payloadSize;
+        m_PayloadInBuffer = false;
+    }
+    else if (blockInfo.Operations.empty())
     {
         PutPayloadInBuffer(variable, blockInfo, sourceRowMajor);
     }
@@ -316,7 +343,7 @@ template <>
 inline BP4Serializer::Stats<std::string> BP4Serializer::GetBPStats(
     const bool /*singleValue*/,
     const typename core::Variable<std::string>::BPInfo & /*blockInfo*/,
-    const bool /*isRowMajor*/) noexcept
+    const bool /*isRowMajor*/, const bool /*payloadStats*/) noexcept
 {
     Stats<std::string> stats;
     stats.Step = m_MetadataSet.TimeStep;
@@ -328,7 +355,8 @@ template <class T>
 BP4Serializer::Stats<T>
 BP4Serializer::GetBPStats(const bool singleValue,
                           const typename core::Variable<T>::BPInfo &blockInfo,
-                          const bool isRowMajor) noexcept
+                          const bool isRowMajor,
+                          const bool payloadStats) noexcept
 {
     Stats<T> stats;
     stats.Step = m_MetadataSet.TimeStep;
@@ -365,9 +393,11 @@ BP4Serializer::GetBPStats(const bool singleValue,
             stats.SubBlockInfo = helper::DivideBlock(
                 blockInfo.Count, m_Parameters.StatsBlockSize,
                 helper::BlockDivisionMethod::Contiguous);
+            // nullptr as for span: set MinMaxs with the correct size only
             helper::GetMinMaxSubblocks(
-                blockInfo.Data, blockInfo.Count, stats.SubBlockInfo,
-                stats.MinMaxs, stats.Min, stats.Max, m_Parameters.Threads);
+                payloadStats ? nullptr : blockInfo.Data, blockInfo.Count,
+                stats.SubBlockInfo, stats.MinMaxs, stats.Min, stats.Max,
+                m_Parameters.Threads);
         }
         else
         {
@@ -382,6 +412,27 @@ BP4Serializer::GetBPStats(const bool singleValue,
     return stats;
 }
 
+template <>
+inline void BP4Serializer::PutPayloadWithStats(
+    const typename core::Variable<std::string>::BPInfo & /*blockInfo*/,
+    Stats<std::string> & /*stats*/) noexcept
+{
+}
+
+template <class T>
+void BP4Serializer::PutPayloadWithStats(
+    const typename core::Variable<T>::BPInfo &blockInfo,
+    Stats<T> &stats) noexcept
+{
+    m_Profiler.Start("memcpy");
+    helper::CopyAndGetMinMaxSubblocks(
+        blockInfo.Data, blockInfo.Count, stats.SubBlockInfo,
+        m_Data.m_Buffer.data() + m_Data.m_Position, stats.MinMaxs, stats.Min,
+        stats.Max, m_Parameters.Threads);
+    m_Profiler.Stop("memcpy");
+    m_PayloadInBuffer = true;
+}
+
 template <class T>
 size_t BP4Serializer::PutVariableMetadataInData(
     const core::Variable<T> &variable,
@@ -13,6 +13,8 @@
 #include "BP5Deserializer.h"
 #include "BP5Deserializer.tcc"
 
+#include <algorithm>
+#include <future>
 #include <string.h>
 
 #ifdef _WIN32
@@ -334,6 +336,25 @@ void BP5Deserializer::SetupForTimestep(size_t Timestep)
     {
         RecPair.second->Variable = NULL;
     }
+    /* writers that don't write a variable in this timestep must not show up
+     * with the blocks of an earlier one */
+    for (auto &VarRecPair : VarByName)
+    {
+        BP5VarRec *VarRec = VarRecPair.second;
+        if (!VarRec)
+        {
+            continue;
+        }
+        std::fill(VarRec->PerWriterBlockCount.begin(),
+                  VarRec->PerWriterBlockCount.end(), 0);
+        std::fill(VarRec->PerWriterStart.begin(),
+                  VarRec->PerWriterStart.end(), nullptr);
+        std::fill(VarRec->PerWriterCounts.begin(),
+                  VarRec->PerWriterCounts.end(), nullptr);
+        std::fill(VarRec->PerWriterDataLocation.begin(),
+                  VarRec->PerWriterDataLocation.end(), nullptr);
+        VarRec->BlockStartValid = false;
+    }
 }
 void BP5Deserializer::InstallMetaData(void *MetadataBlock, size_t BlockLen,
                                       size_t WriterRank)
@@ -424,16 +445,7 @@ void BP5Deserializer::InstallMetaData(void *MetadataBlock, size_t BlockLen,
             VarRec->PerWriterStart[WriterRank] = meta_base->Offsets;
             VarRec->PerWriterCounts[WriterRank] = meta_base->Count;
             VarRec->PerWriterDataLocation[WriterRank] = meta_base->DataLocation;
-            if (WriterRank == 0)
-            {
-                VarRec->PerWriterBlockStart[WriterRank] = 0;
-            }
-            if (WriterRank < m_WriterCohortSize - 1)
-            {
-                VarRec->PerWriterBlockStart[WriterRank + 1] =
-                    VarRec->PerWriterBlockStart[WriterRank] +
-                    VarRec->PerWriterBlockCount[WriterRank];
-            }
+            VarRec->BlockStartValid = false;
 #ifdef NOTDEF
             // needs to be replaced with Simple Blocks Info
             for (int i = 0; i < VarRec->PerWriterBlockCount[WriterRank]; i++)
@@ -590,159 +602,321 @@ bool BP5Deserializer::QueueGet(core::VariableBase &variable, void *DestData)
     return false;
 }
 
-bool BP5Deserializer::NeedWriter(BP5ArrayRequest Req, int i)
+int BP5Deserializer::LocalBlockWriter(BP5VarRec *VarRec, size_t BlockID)
+{
+    auto &BlockStart = VarRec->PerWriterBlockStart;
+    if (!VarRec->BlockStartValid)
+    {
+        size_t Start = 0;
+        for (int WriterRank = 0; WriterRank < m_WriterCohortSize; WriterRank++)
+        {
+            BlockStart[WriterRank] = Start;
+            Start += VarRec->PerWriterBlockCount[WriterRank];
+        }
+        VarRec->BlockStartValid = true;
+    }
+    /* last writer whose first block is <= BlockID, writers without blocks
+     * share their first block ID with the next writer and are skipped */
+    auto End = BlockStart.begin() + m_WriterCohortSize;
+    auto It = std::upper_bound(BlockStart.begin(), End, BlockID);
+    if (It == BlockStart.begin())
+    {
+        return -1;
+    }
+    const int WriterRank = static_cast<int>(It - BlockStart.begin()) - 1;
+    if (BlockID - BlockStart[WriterRank] >=
+        VarRec->PerWriterBlockCount[WriterRank])
+    {
+        return -1;
+    }
+    return WriterRank;
+}
+
+bool BP5Deserializer::NeedWriter(const BP5ArrayRequest &Req, int i)
 {
     if (Req.RequestType == Local)
     {
-        size_t NodeFirst = Req.VarRec->PerWriterBlockStart[i];
-        size_t NodeLast = Req.VarRec->PerWriterBlockCount[i] + NodeFirst - 1;
-        return (NodeFirst <= Req.BlockID) && (NodeLast >= Req.BlockID);
+        return LocalBlockWriter(Req.VarRec, Req.BlockID) == i;
     }
     // else Global case
-    for (int j = 0; j < Req.VarRec->DimCount; j++)
+    if (Req.VarRec->PerWriterStart[i] == NULL)
+    /* this writer didn't write */
     {
-        size_t SelOffset = Req.Start[j];
-        size_t SelSize = Req.Count[j];
-        size_t RankOffset;
-        size_t RankSize;
-        if (Req.VarRec->PerWriterStart[i] == NULL)
-        /* this writer didn't write */
+        return false;
+    }
+    const size_t DimCount = Req.VarRec->DimCount;
+    std::vector<size_t> IntStart(DimCount);
+    std::vector<size_t> IntCount(DimCount);
+    for (size_t Block = 0; Block < Req.VarRec->PerWriterBlockCount[i]; Block++)
+    {
+        if (IntersectBlock(DimCount,
+                           Req.VarRec->PerWriterStart[i] + Block * DimCount,
+                           Req.VarRec->PerWriterCounts[i] + Block * DimCount,
+                           Req.Start.data(), Req.Count.data(), IntStart.data(),
+                           IntCount.data()))
         {
-            return false;
+            return true;
         }
-        RankOffset = Req.VarRec->PerWriterStart[i][j];
-        RankSize = Req.VarRec->PerWriterCounts[i][j];
-        if ((SelSize == 0) || (RankSize == 0))
+    }
+    return false;
+}
+
+/*
+ * Intersect a data block (BlockStart/BlockCount) with a selection
+ * (SelStart/SelCount), all in the same coordinate space.  Returns false if
+ * the intersection is empty, otherwise fills OutStart/OutCount.
+ */
+bool BP5Deserializer::IntersectBlock(size_t Dims, const size_t *BlockStart,
+                                     const size_t *BlockCount,
+                                     const size_t *SelStart,
+                                     const size_t *SelCount, size_t *OutStart,
+                                     size_t *OutCount)
+{
+    for (size_t Dim = 0; Dim < Dims; Dim++)
+    {
+        if ((BlockCount[Dim] == 0) || (SelCount[Dim] == 0))
         {
             return false;
         }
-        if ((RankOffset < SelOffset && (RankOffset + RankSize) <= SelOffset) ||
-            (RankOffset >= SelOffset + SelSize))
+        const size_t Left = std::max(BlockStart[Dim], SelStart[Dim]);
+        const size_t Right = std::min(BlockStart[Dim] + BlockCount[Dim],
+                                      SelStart[Dim] + SelCount[Dim]);
+        if (Left >= Right)
         {
             return false;
         }
+        OutStart[Dim] = Left;
+        OutCount[Dim] = Right - Left;
     }
     return true;
 }
 
+static size_t FindOffsetCM(size_t Dims, const size_t *Size,
+                           const size_t *Index)
+{
+    size_t Offset = 0;
+    for (int i = Dims - 1; i >= 0; i--)
+    {
+        Offset = Index[i] + (Size[i] * Offset);
+    }
+    return Offset;
+}
+
+/*
+ * Rather than reading the whole data block of every writer that holds
+ * anything of interest, generate one read request per (Get, writer, block)
+ * covering only the bytes between the first and the last selected element
+ * of that block.  For slab selections on row-major data this range is
+ * contiguous and exactly the needed data.
+ */
 std::vector<BP5Deserializer::ReadRequest>
 BP5Deserializer::GenerateReadRequests()
 {
     std::vector<BP5Deserializer::ReadRequest> Ret;
-    for (auto &W : WriterInfo)
-    {
-        W.Status = Empty;
-        W.RawBuffer = NULL;
-    }
 
-    for (const auto &Req : PendingRequests)
+    for (size_t ReqIndex = 0; ReqIndex < PendingRequests.size(); ReqIndex++)
     {
-        for (int i = 0; i < m_WriterCohortSize; i++)
+        const auto &Req = PendingRequests[ReqIndex];
+        const BP5VarRec *VarRec = Req.VarRec;
+        const size_t DimCount = VarRec->DimCount;
+        std::vector<size_t> ZeroSel(DimCount);
+        std::vector<size_t> IntStart(DimCount);
+        std::vector<size_t> IntCount(DimCount);
+        std::vector<size_t> FirstIndex(DimCount);
+        std::vector<size_t> LastIndex(DimCount);
+
+        /* a block selection needs exactly one block of one writer, found
+         * in the block prefix table instead of asking every writer */
+        int WriterBegin = 0;
+        int WriterEnd = m_WriterCohortSize;
+        if (Req.RequestType == Local)
         {
-            if ((WriterInfo[i].Status != Needed) && (NeedWriter(Req, i)))
+            WriterBegin = LocalBlockWriter(Req.VarRec, Req.BlockID);
+            if (WriterBegin < 0)
             {
-                WriterInfo[i].Status = Needed;
+                throw std::invalid_argument(
+                    "ERROR: BlockID " + std::to_string(Req.BlockID) +
+                    " of variable " + std::string(VarRec->VarName) +
+                    " does not exist in this step, in call to Get\n");
             }
+            WriterEnd = WriterBegin + 1;
         }
-    }
-
-    for (int i = 0; i < m_WriterCohortSize; i++)
-    {
-        if (WriterInfo[i].Status == Needed)
-        {
-            ReadRequest RR;
-            RR.Timestep = CurTimestep;
-            RR.WriterRank = i;
-            RR.StartOffset = 0;
-            RR.ReadLength =
-                ((struct FFSMetadataInfoStruct *)MetadataBaseAddrs[i])
-                    ->DataBlockSize;
-            RR.DestinationAddr = (char *)malloc(RR.ReadLength);
-            RR.Internal = NULL;
-            Ret.push_back(RR);
-        }
-    }
-    return Ret;
-}
-
-void BP5Deserializer::FinalizeGets(std::vector<ReadRequest> Requests)
-{
-    for (const auto &Req : PendingRequests)
-    {
-        //        ImplementGapWarning(Reqs);
-        for (int i = 0; i < m_WriterCohortSize; i++)
+        for (int WriterRank = WriterBegin; WriterRank < WriterEnd;
+             WriterRank++)
         {
-            if (NeedWriter(Req, i))
+            size_t FirstBlock = 0;
+            size_t BlockLimit = VarRec->PerWriterBlockCount[WriterRank];
+            if (Req.RequestType == Local)
             {
-                /* if needed this writer fill destination with acquired data */
-                int ElementSize = Req.VarRec->ElementSize;
-                int DimCount = Req.VarRec->DimCount;
-                size_t *GlobalDimensions = Req.VarRec->GlobalDims;
-                size_t *RankOffset = Req.VarRec->PerWriterStart[i];
-                const size_t *RankSize = Req.VarRec->PerWriterCounts[i];
-                std::vector<size_t> ZeroSel(DimCount);
-                std::vector<size_t> ZeroRankOffset(DimCount);
-                std::vector<size_t> ZeroGlobalDimensions(DimCount);
-                const size_t *SelOffset = NULL;
-                const size_t *SelSize = Req.Count.data();
-                int ReqIndex = 0;
-                while (Requests[ReqIndex].WriterRank != i)
-                    ReqIndex++;
-                char *IncomingData =
-                    (char *)Requests[ReqIndex].DestinationAddr +
-                    Req.VarRec->PerWriterDataLocation[i][0];
-
-                if (Req.Start.size())
+                FirstBlock =
+                    Req.BlockID - VarRec->PerWriterBlockStart[WriterRank];
+                BlockLimit = FirstBlock + 1;
+            }
+            else if (!NeedWriter(Req, WriterRank))
+            {
+                continue;
+            }
+            for (size_t Block = FirstBlock; Block < BlockLimit; Block++)
+            {
+                const size_t *BlockCount =
+                    VarRec->PerWriterCounts[WriterRank] + Block * DimCount;
+                const size_t *BlockStart;
+                const size_t *SelStart;
+                if (Req.RequestType == Local)
                 {
-                    SelOffset = Req.Start.data();
+                    /* local selections are relative to the block itself */
+                    BlockStart = ZeroSel.data();
+                    SelStart =
+                        Req.Start.size() ? Req.Start.data() : ZeroSel.data();
                 }
-                if (Req.RequestType == Local)
+                else
                 {
-                    int LocalBlockID =
-                        Req.BlockID - Req.VarRec->PerWriterBlockStart[i];
-                    size_t DataOffset = 0;
-                    for (int i = 0; i < LocalBlockID; i++)
-                    {
-                        int BlockElemCount = 1;
-                        for (int j = 0; j < DimCount; j++)
-                        {
-                            BlockElemCount *= RankSize[j];
-                        }
-                        DataOffset += BlockElemCount * ElementSize;
-                        RankSize += DimCount;
-                    }
-                    RankOffset = ZeroRankOffset.data();
-                    GlobalDimensions = ZeroGlobalDimensions.data();
-                    if (SelOffset == NULL)
-                    {
-                        SelOffset = ZeroSel.data();
-                    }
-                    for (int i = 0; i < DimCount; i++)
-                    {
-                        GlobalDimensions[i] = RankSize[i];
-                    }
-                    IncomingData = IncomingData + DataOffset;
+                    BlockStart =
+                        VarRec->PerWriterStart[WriterRank] + Block * DimCount;
+                    SelStart = Req.Start.data();
                 }
+                if (!IntersectBlock(DimCount, BlockStart, BlockCount, SelStart,
+                                    Req.Count.data(), IntStart.data(),
+                                    IntCount.data()))
+                {
+                    continue;
+                }
+                for (size_t Dim = 0; Dim < DimCount; Dim++)
+                {
+                    FirstIndex[Dim] = IntStart[Dim] - BlockStart[Dim];
+                    LastIndex[Dim] = FirstIndex[Dim] + IntCount[Dim] - 1;
+                }
+                size_t FirstElement;
+                size_t LastElement;
                 if (m_ReaderIsRowMajor)
                 {
-                    ExtractSelectionFromPartialRM(
-                        ElementSize, DimCount, GlobalDimensions, RankOffset,
-                        RankSize, SelOffset, SelSize, IncomingData,
-                        (char *)Req.Data);
+                    FirstElement =
+                        FindOffset(DimCount, BlockCount, FirstIndex.data());
+                    LastElement =
+                        FindOffset(DimCount, BlockCount, LastIndex.data());
                 }
                 else
                 {
-                    ExtractSelectionFromPartialCM(
-                        ElementSize, DimCount, GlobalDimensions, RankOffset,
-                        RankSize, SelOffset, SelSize, IncomingData,
-                        (char *)Req.Data);
+                    FirstElement =
+                        FindOffsetCM(DimCount, BlockCount, FirstIndex.data());
+                    LastElement =
+                        FindOffsetCM(DimCount, BlockCount, LastIndex.data());
                 }
+
+                ReadRequest RR;
+                RR.Timestep = CurTimestep;
+                RR.WriterRank = WriterRank;
+                RR.OffsetInBlock = FirstElement * VarRec->ElementSize;
+                RR.StartOffset =
+                    VarRec->PerWriterDataLocation[WriterRank][Block] +
+                    RR.OffsetInBlock;
+                RR.ReadLength =
+                    (LastElement - FirstElement + 1) * VarRec->ElementSize;
+                RR.DestinationAddr = NULL;
+                RR.ReqIndex = ReqIndex;
+                RR.BlockID = Block;
+                RR.Internal = NULL;
+                Ret.push_back(RR);
             }
         }
     }
-    for (const auto &Req : Requests)
+    return Ret;
+}
+
+/* don't start a thread for less than this many bytes of copying */
+static const size_t MinCopyBytesPerThread = 1024 * 1024;
+
+void BP5Deserializer::FinalizeGets(std::vector<ReadRequest> Requests)
+{
+    std::vector<SelectionCopy> Copies;
+    Copies.reserve(Requests.size());
+    size_t TotalBytes = 0;
+    for (const auto &Read : Requests)
     {
-        free((char *)Req.DestinationAddr);
+        const auto &Req = PendingRequests[Read.ReqIndex];
+        const BP5VarRec *VarRec = Req.VarRec;
+        int ElementSize = VarRec->ElementSize;
+        size_t DimCount = VarRec->DimCount;
+        const size_t *GlobalDimensions = VarRec->GlobalDims;
+        const size_t *RankOffset = NULL;
+        const size_t *RankSize =
+            VarRec->PerWriterCounts[Read.WriterRank] + Read.BlockID * DimCount;
+        std::vector<size_t> ZeroSel(DimCount);
+        const size_t *SelOffset = Req.Start.data();
+        const size_t *SelSize = Req.Count.data();
+        /* only the bytes from OffsetInBlock onwards of this block were read,
+         * the extraction below never touches anything before that */
+        const char *IncomingData = Read.DestinationAddr - Read.OffsetInBlock;
+
+        if (Req.RequestType == Local)
+        {
+            RankOffset = ZeroSel.data();
+            GlobalDimensions = RankSize;
+            if (Req.Start.empty())
+            {
+                SelOffset = ZeroSel.data();
+            }
+        }
+        else
+        {
+            RankOffset = VarRec->PerWriterStart[Read.WriterRank] +
+                         Read.BlockID * DimCount;
+        }
+        SelectionCopy Copy;
+        if (m_ReaderIsRowMajor)
+        {
+            Copy = PlanSelectionFromPartialRM(
+                ElementSize, DimCount, GlobalDimensions, RankOffset, RankSize,
+                SelOffset, SelSize, IncomingData, (char *)Req.Data);
+        }
+        else
+        {
+            Copy = PlanSelectionFromPartialCM(
+                ElementSize, DimCount, GlobalDimensions, RankOffset, RankSize,
+                SelOffset, SelSize, IncomingData, (char *)Req.Data);
+        }
+        if (Copy.Size() > 0)
+        {
+            Copies.push_back(Copy);
+            TotalBytes += Copy.Size();
+        }
+    }
+
+    /* The copies of different reads never overlap in the destination, so
+     * the concatenation of all of them is cut into one equal byte range per
+     * thread, which also splits a single large copy */
+    const size_t nThreads = std::max<size_t>(
+        1, std::min(m_Threads, TotalBytes / MinCopyBytesPerThread));
+    const size_t BytesPerThread = (TotalBytes + nThreads - 1) / nThreads;
+    auto lf_CopyRange = [&](const size_t Begin, const size_t End) {
+        size_t CopyStart = 0;
+        for (const auto &Copy : Copies)
+        {
+            const size_t CopyEnd = CopyStart + Copy.Size();
+            if (CopyEnd > Begin && CopyStart < End)
+            {
+                RunSelectionCopy(Copy, std::max(Begin, CopyStart) - CopyStart,
+                                 std::min(End, CopyEnd) - CopyStart);
+            }
+            if (CopyEnd >= End)
+            {
+                break;
+            }
+            CopyStart = CopyEnd;
+        }
+    };
+    std::vector<std::future<void>> futures;
+    futures.reserve(nThreads - 1);
+    for (size_t t = 1; t < nThreads; ++t)
+    {
+        futures.push_back(std::async(
+            std::launch::async, lf_CopyRange, t * BytesPerThread,
+            std::min((t + 1) * BytesPerThread, TotalBytes)));
+    }
+    lf_CopyRange(0, std::min(BytesPerThread, TotalBytes));
+    for (auto &f : futures)
+    {
+        f.get();
     }
     PendingRequests.clear();
 }
@@ -758,10 +932,10 @@ void BP5Deserializer::MapGlobalToLocalIndex(size_t Dims,
     }
 }
 
-int BP5Deserializer::FindOffset(size_t Dims, const size_t *Size,
-                                const size_t *Index)
+size_t BP5Deserializer::FindOffset(size_t Dims, const size_t *Size,
+                                   const size_t *Index)
 {
-    int Offset = 0;
+    size_t Offset = 0;
     for (int i = 0; i < Dims; i++)
     {
         Offset = Index[i] + (Size[i] * Offset);
@@ -769,16 +943,6 @@ int BP5Deserializer::FindOffset(size_t Dims, const size_t *Size,
     return Offset;
 }
 
-static int FindOffsetCM(size_t Dims, const size_t *Size, const size_t *Index)
-{
-    int Offset = 0;
-    for (int i = Dims - 1; i >= 0; i--)
-    {
-        Offset = Index[i] + (Size[i] * Offset);
-    }
-    return Offset;
-}
-
 #define MAX(x, y) (((x) > (y)) ? (x) : (y))
 #define MIN(x, y) (((x) < (y)) ? (x) : (y))
 
@@ -802,7 +966,7 @@ static int FindOffsetCM(size_t Dims, const size_t *Size, const size_t *Index)
 /*
  * *******************************
  *
- * ExtractSelectionFromPartial*M both need to be extended to work when
+ * PlanSelectionFromPartial*M both need to be extended to work when
  * the reader and writer have different byte orders.  This involves at
  * least supporting simple big/little-endian byte reversal, but a true
  * archival format should also consider mixed and middle-endian
@@ -813,7 +977,7 @@ static int FindOffsetCM(size_t Dims, const size_t *Size, const size_t *Index)
  */
 
 // Row major version
-void BP5Deserializer::ExtractSelectionFromPartialRM(
+BP5Deserializer::SelectionCopy BP5Deserializer::PlanSelectionFromPartialRM(
     int ElementSize, size_t Dims, const size_t *GlobalDims,
     const size_t *PartialOffsets, const size_t *PartialCounts,
     const size_t *SelectionOffsets, const size_t *SelectionCounts,
@@ -882,20 +1046,17 @@ void BP5Deserializer::ExtractSelectionFromPartialRM(
     free(PartialIndex);
     SourceBlockStartOffset *= ElementSize;
 
-    InData += SourceBlockStartOffset;
-    OutData += DestBlockStartOffset;
-    size_t i;
-    for (i = 0; i < BlockCount; i++)
-    {
-        memcpy(OutData, InData, BlockSize * ElementSize);
-        InData += SourceBlockStride;
-        OutData += DestBlockStride;
-    }
     free(FirstIndex);
+    return {InData + SourceBlockStartOffset,
+            OutData + DestBlockStartOffset,
+            BlockCount,
+            BlockSize * ElementSize,
+            SourceBlockStride,
+            DestBlockStride};
 }
 
 // Column-major version
-void BP5Deserializer::ExtractSelectionFromPartialCM(
+BP5Deserializer::SelectionCopy BP5Deserializer::PlanSelectionFromPartialCM(
     int ElementSize, size_t Dims, const size_t *GlobalDims,
     const size_t *PartialOffsets, const size_t *PartialCounts,
     const size_t *SelectionOffsets, const size_t *SelectionCounts,
@@ -971,15 +1132,29 @@ void BP5Deserializer::ExtractSelectionFromPartialCM(
     free(PartialIndex);
     SourceBlockStartOffset *= OperantElementSize;
 
-    InData += SourceBlockStartOffset;
-    OutData += DestBlockStartOffset;
-    for (int i = 0; i < BlockCount; i++)
+    free(FirstIndex);
+    return {InData + SourceBlockStartOffset,
+            OutData + DestBlockStartOffset,
+            static_cast<size_t>(BlockCount),
+            static_cast<size_t>(BlockSize) * ElementSize,
+            static_cast<size_t>(SourceBlockStride),
+            static_cast<size_t>(DestBlockStride)};
+}
+
+void BP5Deserializer::RunSelectionCopy(const SelectionCopy &Copy, size_t Begin,
+                                       const size_t End)
+{
+    size_t Block = Begin / Copy.BlockBytes;
+    size_t Offset = Begin % Copy.BlockBytes;
+    while (Begin < End)
     {
-        memcpy(OutData, InData, BlockSize * ElementSize);
-        InData += SourceBlockStride;
-        OutData += DestBlockStride;
+        const size_t Len = std::min(Copy.BlockBytes - Offset, End - Begin);
+        memcpy(Copy.OutData + Block * Copy.DestStride + Offset,
+               Copy.InData + Block * Copy.SourceStride + Offset, Len);
+        Begin += Len;
+        Block++;
+        Offset = 0;
     }
-    free(FirstIndex);
 }
 
 BP5Deserializer::BP5Deserializer(int WriterCount, bool WriterIsRowMajor,
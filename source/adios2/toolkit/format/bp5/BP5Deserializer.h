@@ -36,6 +36,17 @@ public:
 
     ~BP5Deserializer();
 
+    /*
+     * A ReadRequest describes one contiguous byte range within the data
+     * block of a single writer.  StartOffset is relative to the start of
+     * that writer's data block, and the range covers only the part of one
+     * array block (BlockID, writer-local) that the pending Get with index
+     * ReqIndex actually needs.  OffsetInBlock is the position of
+     * StartOffset relative to the start of that array block.
+     * DestinationAddr is left NULL by GenerateReadRequests(), the engine
+     * provides (and afterwards releases) the memory the range is read into
+     * before calling FinalizeGets().
+     */
     struct ReadRequest
     {
         size_t Timestep;
@@ -43,6 +54,9 @@ public:
         size_t StartOffset;
         size_t ReadLength;
         char *DestinationAddr;
+        size_t ReqIndex;
+        size_t BlockID;
+        size_t OffsetInBlock;
         void *Internal;
     };
     void InstallMetaMetaData(MetaMetaInfoBlock &MMList);
@@ -59,6 +73,8 @@ public:
     bool m_WriterIsRowMajor = 1;
     bool m_ReaderIsRowMajor = 1;
     core::Engine *m_Engine = NULL;
+    /** number of threads FinalizeGets() may use to copy the selections */
+    size_t m_Threads = 1;
 
     template <class T>
     std::vector<typename core::Variable<T>::BPInfo>
@@ -74,7 +90,10 @@ private:
         int ElementSize = 0;
         size_t *GlobalDims = NULL;
         std::vector<size_t> PerWriterMetaFieldOffset;
+        /* prefix sum of PerWriterBlockCount, first (global) block ID of
+         * each writer, built on demand by LocalBlockWriter() */
         std::vector<size_t> PerWriterBlockStart;
+        bool BlockStartValid = false;
         std::vector<size_t> PerWriterBlockCount;
         std::vector<size_t *> PerWriterStart;
         std::vector<size_t *> PerWriterCounts;
@@ -159,21 +178,42 @@ private:
                         size_t *Start, size_t *Count);
     void MapGlobalToLocalIndex(size_t Dims, const size_t *GlobalIndex,
                                const size_t *LocalOffsets, size_t *LocalIndex);
-    int FindOffset(size_t Dims, const size_t *Size, const size_t *Index);
-    void ExtractSelectionFromPartialRM(int ElementSize, size_t Dims,
-                                       const size_t *GlobalDims,
-                                       const size_t *PartialOffsets,
-                                       const size_t *PartialCounts,
-                                       const size_t *SelectionOffsets,
-                                       const size_t *SelectionCounts,
-                                       const char *InData, char *OutData);
-    void ExtractSelectionFromPartialCM(int ElementSize, size_t Dims,
-                                       const size_t *GlobalDims,
-                                       const size_t *PartialOffsets,
-                                       const size_t *PartialCounts,
-                                       const size_t *SelectionOffsets,
-                                       const size_t *SelectionCounts,
-                                       const char *InData, char *OutData);
+    size_t FindOffset(size_t Dims, const size_t *Size, const size_t *Index);
+    bool IntersectBlock(size_t Dims, const size_t *BlockStart,
+                        const size_t *BlockCount, const size_t *SelStart,
+                        const size_t *SelCount, size_t *OutStart,
+                        size_t *OutCount);
+
+    /*
+     * The copies that move the intersection of a partial block (InData)
+     * with a selection (OutData) into place: BlockCount runs of BlockBytes
+     * bytes each, consecutive runs are SourceStride/DestStride bytes apart.
+     * Viewed as BlockCount * BlockBytes bytes, any byte range of it can be
+     * copied independently of the rest.
+     */
+    struct SelectionCopy
+    {
+        const char *InData;
+        char *OutData;
+        size_t BlockCount;
+        size_t BlockBytes;
+        size_t SourceStride;
+        size_t DestStride;
+        size_t Size() const { return BlockCount * BlockBytes; }
+    };
+    /** copy bytes [Begin, End) of Copy */
+    static void RunSelectionCopy(const SelectionCopy &Copy, size_t Begin,
+                                 const size_t End);
+    SelectionCopy PlanSelectionFromPartialRM(
+        int ElementSize, size_t Dims, const size_t *GlobalDims,
+        const size_t *PartialOffsets, const size_t *PartialCounts,
+        const size_t *SelectionOffsets, const size_t *SelectionCounts,
+        const char *InData, char *OutData);
+    SelectionCopy PlanSelectionFromPartialCM(
+        int ElementSize, size_t Dims, const size_t *GlobalDims,
+        const size_t *PartialOffsets, const size_t *PartialCounts,
+        const size_t *SelectionOffsets, const size_t *SelectionCounts,
+        const char *InData, char *OutData);
 
     enum RequestTypeEnum
     {
@@ -191,7 +231,10 @@ private:
         void *Data;
     };
     std::vector<BP5ArrayRequest> PendingRequests;
-    bool NeedWriter(BP5ArrayRequest Req, int i);
+    bool NeedWriter(const BP5ArrayRequest &Req, int i);
+    /** @return the writer holding the (global) block BlockID of VarRec in
+     * the current timestep, -1 if there is no such block */
+    int LocalBlockWriter(BP5VarRec *VarRec, size_t BlockID);
     size_t CurTimestep = 0;
     std::vector<struct ControlInfo *> ActiveControl;
 };
@@ -10,8 +10,11 @@
 #include "adios2/core/IO.h"
 #include "adios2/helper/adiosMemory.h"
 #include "adios2/toolkit/format/buffer/ffs/BufferFFS.h"
+#include "adios2/toolkit/format/buffer/heap/BufferVSTL.h"
 
 #include <cstring>
+#include <stdexcept>
+#include <string>
 
 #include "BP5Serializer.h"
 
@@ -45,6 +48,18 @@ BP5Serializer::~BP5Serializer()
             free(((FFSMetadataInfoStruct *)MetadataBuf)->BitField);
         free(MetadataBuf);
     }
+    delete CurDataBuffer;
+}
+
+void BP5Serializer::InitStep(BufferV *DataBuffer)
+{
+    if (CurDataBuffer != NULL)
+    {
+        delete DataBuffer;
+        throw std::logic_error(
+            "ERROR: BP5Serializer::InitStep called with a step in progress\n");
+    }
+    CurDataBuffer = DataBuffer;
 }
 
 void BP5Serializer::Init()
@@ -472,7 +487,7 @@ void BP5Serializer::Marshal(void *Variable, const char *Name,
         MetaEntry->Dims = DimCount;
         if (CurDataBuffer == NULL)
         {
-            CurDataBuffer = new BufferV("data buffer");
+            CurDataBuffer = new BufferVSTL("data buffer");
         }
         DataOffset =
             CurDataBuffer->AddToVec(ElemCount * ElemSize, Data, ElemSize, Sync);
@@ -667,7 +682,7 @@ BP5Serializer::TimestepInfo BP5Serializer::CloseTimestep(int timestep)
 
     if (CurDataBuffer == NULL)
     {
-        CurDataBuffer = new BufferV("data buffer");
+        CurDataBuffer = new BufferVSTL("data buffer");
     }
     MBase->DataBlockSize = CurDataBuffer->AddToVec(
         0, NULL, 8, true); //  output block size multiple of 8, offset is size
@@ -797,18 +812,85 @@ std::vector<char> BP5Serializer::CopyMetadataToContiguous(
     return Ret;
 }
 
+void BP5Serializer::AppendMetadataDroppingKnownMetaMeta(
+    const char *Block, const size_t BlockSize,
+    std::unordered_set<std::string> &KnownMetaMetaIDs,
+    std::vector<char> &Out) const
+{
+    auto lf_Read = [&](size_t &Position, void *Dest, size_t Size) {
+        if (Position + Size > BlockSize)
+        {
+            throw std::runtime_error(
+                "ERROR: truncated BP5 metadata block in "
+                "AppendMetadataDroppingKnownMetaMeta\n");
+        }
+        std::memcpy(Dest, Block + Position, Size);
+        Position += Size;
+    };
+
+    size_t Position = 0;
+    int32_t NMMBCount;
+    lf_Read(Position, &NMMBCount, sizeof(NMMBCount));
+
+    // the count is patched once we know how many blocks are kept
+    const size_t CountPosition = Out.size();
+    int32_t KeptCount = 0;
+    Out.insert(Out.end(), Block, Block + sizeof(NMMBCount));
+    for (int i = 0; i < NMMBCount; i++)
+    {
+        const size_t EntryPosition = Position;
+        uint64_t IDLen;
+        uint64_t InfoLen;
+        lf_Read(Position, &IDLen, sizeof(IDLen));
+        lf_Read(Position, &InfoLen, sizeof(InfoLen));
+        if (Position + IDLen + InfoLen > BlockSize)
+        {
+            throw std::runtime_error(
+                "ERROR: truncated BP5 metadata block in "
+                "AppendMetadataDroppingKnownMetaMeta\n");
+        }
+        std::string ID(Block + Position, IDLen);
+        Position += IDLen + InfoLen;
+        if (KnownMetaMetaIDs.insert(std::move(ID)).second)
+        {
+            Out.insert(Out.end(), Block + EntryPosition, Block + Position);
+            ++KeptCount;
+        }
+    }
+    std::memcpy(Out.data() + CountPosition, &KeptCount, sizeof(KeptCount));
+    // metadata, attributes and data size are kept as they are
+    Out.insert(Out.end(), Block + Position, Block + BlockSize);
+}
+
 std::vector<BufferV::iovec> BP5Serializer::BreakoutContiguousMetadata(
     std::vector<char> *Aggregate, const std::vector<size_t> Counts,
     std::vector<MetaMetaInfoBlock> &UniqueMetaMetaBlocks,
     std::vector<BufferV::iovec> &AttributeBlocks,
     std::vector<uint64_t> &DataSizes) const
 {
-    size_t Position = 0;
+    std::vector<size_t> Starts(Counts.size());
+    size_t Start = 0;
+    for (size_t Rank = 0; Rank < Counts.size(); Rank++)
+    {
+        Starts[Rank] = Start;
+        Start += Counts[Rank];
+    }
+    return BreakoutMetadata(Aggregate, Starts, UniqueMetaMetaBlocks,
+                            AttributeBlocks, DataSizes);
+}
+
+std::vector<BufferV::iovec> BP5Serializer::BreakoutMetadata(
+    std::vector<char> *Aggregate, const std::vector<size_t> &Starts,
+    std::vector<MetaMetaInfoBlock> &UniqueMetaMetaBlocks,
+    std::vector<BufferV::iovec> &AttributeBlocks,
+    std::vector<uint64_t> &DataSizes) const
+{
     std::vector<BufferV::iovec> MetadataBlocks;
-    MetadataBlocks.reserve(Counts.size());
-    DataSizes.resize(Counts.size());
-    for (int Rank = 0; Rank < Counts.size(); Rank++)
+    MetadataBlocks.reserve(Starts.size());
+    DataSizes.resize(Starts.size());
+    for (int Rank = 0; Rank < Starts.size(); Rank++)
     {
+        size_t Position = Starts[Rank];
         int32_t NMMBCount;
         helper::CopyFromBuffer(*Aggregate, Position, &NMMBCount);
         for (int i = 0; i < NMMBCount; i++)
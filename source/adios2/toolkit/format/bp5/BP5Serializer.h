@@ -16,6 +16,10 @@
 #include "atl.h"
 #include "ffs.h"
 #include "fm.h"
+
+#include <string>
+#include <unordered_set>
+
 #ifdef _WIN32
 #pragma warning(disable : 4250)
 #endif
@@ -59,6 +63,10 @@ public:
         Buffer BackingBuffer;
     } AggregatedMetadataInfo;
 
+    /** Use DataBuffer (taking ownership) for the data of the next step.
+     * Without a call, a contiguous BufferVSTL is created on first use */
+    void InitStep(BufferV *DataBuffer);
+
     void Marshal(void *Variable, const char *Name, const DataType Type,
                  size_t ElemSize, size_t DimCount, const size_t *Shape,
                  const size_t *Count, const size_t *Offsets, const void *Data,
@@ -80,6 +88,23 @@ public:
         std::vector<BufferV::iovec> &AttributeBlocks,
         std::vector<uint64_t> &DataSizes) const;
 
+    /** Same as BreakoutContiguousMetadata, but the block of rank i starts
+     * at Starts[i] in Aggregate, blocks need not be in rank order */
+    std::vector<BufferV::iovec>
+    BreakoutMetadata(std::vector<char> *Aggregate,
+                     const std::vector<size_t> &Starts,
+                     std::vector<MetaMetaInfoBlock> &UniqueMetaMetaBlocks,
+                     std::vector<BufferV::iovec> &AttributeBlocks,
+                     std::vector<uint64_t> &DataSizes) const;
+
+    /** Append a block made by CopyMetadataToContiguous to Out, leaving out
+     * the meta-meta blocks whose ID is in KnownMetaMetaIDs. The IDs of the
+     * meta-meta blocks that are kept are added to KnownMetaMetaIDs */
+    void AppendMetadataDroppingKnownMetaMeta(
+        const char *Block, const size_t BlockSize,
+        std::unordered_set<std::string> &KnownMetaMetaIDs,
+        std::vector<char> &Out) const;
+
 private:
     void Init();
     typedef struct _BP5WriterRec
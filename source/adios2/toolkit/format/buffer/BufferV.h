@@ -9,37 +9,49 @@
 
 #include "adios2/common/ADIOSConfig.h"
 #include "adios2/common/ADIOSTypes.h"
-#include "heap/BufferSTL.h"
+#include "adios2/core/CoreTypes.h"
+
+#include <vector>
 
 namespace adios2
 {
 namespace format
 {
 
+/** Base class of the vector (gather list) data buffers used by BP5
+ * marshaling. Data is either referenced in place (external, zero-copy) or
+ * copied into memory owned by the buffer, DataVec() returns the list of
+ * memory regions in data order */
 class BufferV
 {
 public:
     const std::string m_Type;
 
-    typedef struct iovec
-    {
-        const void
-            *iov_base;  //  Base address of a memory region for input or output.
-        size_t iov_len; //  The size of the memory pointed to by iov_base.
-    } * BufferV_iovec;
+    typedef core::iovec iovec;
+    typedef core::iovec *BufferV_iovec;
 
     uint64_t Size() noexcept;
 
     BufferV(const std::string type);
     virtual ~BufferV() = default;
 
-    virtual BufferV_iovec DataVec() noexcept;
+    /** @return NULL-terminated array of memory regions, to be released
+     * with delete[] by the caller */
+    virtual BufferV_iovec DataVec() noexcept = 0;
     //  virtual const BufferV_iovec DataVec() const noexcept;
 
+    /**
+     * Add size bytes at buf to the end of the buffer
+     * @param align pad with zeros so that the data starts at an offset that
+     * is a multiple of align
+     * @param CopyReqd true: copy the data into the buffer, false: only keep
+     * a reference, the memory has to stay valid until the data is written
+     * @return offset of the data from the beginning of the buffer
+     */
     virtual size_t AddToVec(const size_t size, const void *buf, int align,
-                            bool CopyReqd);
+                            bool CopyReqd) = 0;
 
-private:
+protected:
     struct VecEntry
     {
         bool External;
@@ -49,8 +61,6 @@ private:
     };
     std::vector<VecEntry> DataV;
     size_t CurOffset = 0;
-    size_t m_internalPos = 0;
-    BufferSTL InternalBlock;
 };
 
 } // end namespace format
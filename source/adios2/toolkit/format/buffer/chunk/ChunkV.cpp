@@ -0,0 +1,157 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * ChunkV.cpp
+ *
+ */
+
+#include "ChunkV.h"
+
+#include <algorithm> // std::min
+#include <new>       // std::bad_alloc
+#include <stdexcept> // std::invalid_argument
+#include <stdlib.h>  // malloc, free
+#include <string.h>  // memcpy
+
+namespace adios2
+{
+namespace format
+{
+
+ChunkPool::ChunkPool(const size_t chunkSize) : m_ChunkSize(chunkSize)
+{
+    if (m_ChunkSize == 0)
+    {
+        throw std::invalid_argument(
+            "ERROR: chunk size of BufferV chunk pool must be > 0\n");
+    }
+}
+
+ChunkPool::~ChunkPool()
+{
+    for (char *chunk : m_FreeChunks)
+    {
+        free(chunk);
+    }
+}
+
+char *ChunkPool::Get()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (!m_FreeChunks.empty())
+        {
+            char *chunk = m_FreeChunks.back();
+            m_FreeChunks.pop_back();
+            return chunk;
+        }
+    }
+    char *chunk = static_cast<char *>(malloc(m_ChunkSize));
+    if (chunk == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return chunk;
+}
+
+void ChunkPool::Release(char *chunk) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    try
+    {
+        m_FreeChunks.push_back(chunk);
+    }
+    catch (...)
+    {
+        free(chunk);
+    }
+}
+
+size_t ChunkPool::ChunkSize() const noexcept { return m_ChunkSize; }
+
+ChunkV::ChunkV(const std::string type, ChunkPool &pool)
+: BufferV(type), m_Pool(pool)
+{
+}
+
+ChunkV::~ChunkV()
+{
+    for (char *chunk : m_Chunks)
+    {
+        m_Pool.Release(chunk);
+    }
+}
+
+size_t ChunkV::AddToVec(const size_t size, const void *buf, int align,
+                        bool CopyReqd)
+{
+    int badAlign = CurOffset % align;
+    if (badAlign)
+    {
+        int addAlign = align - badAlign;
+        char zero[16] = {0};
+        AddToVec(addAlign, zero, 1, true);
+    }
+    size_t retOffset = CurOffset;
+
+    if (size == 0)
+        return CurOffset;
+
+    if (!CopyReqd)
+    {
+        // just add buf to internal version of output vector
+        VecEntry entry = {true, buf, 0, size};
+        DataV.push_back(entry);
+    }
+    else
+    {
+        const size_t chunkSize = m_Pool.ChunkSize();
+        const char *src = static_cast<const char *>(buf);
+        size_t remaining = size;
+        while (remaining > 0)
+        {
+            if (m_Chunks.empty() || m_TailPos == chunkSize)
+            {
+                // reserve first so a chunk is never lost if push_back throws
+                m_Chunks.reserve(m_Chunks.size() + 1);
+                m_Chunks.push_back(m_Pool.Get());
+                m_TailPos = 0;
+            }
+            const size_t n = std::min(remaining, chunkSize - m_TailPos);
+            memcpy(m_Chunks.back() + m_TailPos, src, n);
+            if (DataV.size() && !DataV.back().External &&
+                DataV.back().Base == m_Chunks.back() &&
+                (m_TailPos == (DataV.back().Offset + DataV.back().Size)))
+            {
+                // just add to the size of the existing tail entry
+                DataV.back().Size += n;
+            }
+            else
+            {
+                DataV.push_back({false, m_Chunks.back(), m_TailPos, n});
+            }
+            m_TailPos += n;
+            src += n;
+            remaining -= n;
+        }
+    }
+    CurOffset = retOffset + size;
+    return retOffset;
+}
+
+BufferV::BufferV_iovec ChunkV::DataVec() noexcept
+{
+    BufferV_iovec ret = new iovec[DataV.size() + 1];
+    for (std::size_t i = 0; i < DataV.size(); ++i)
+    {
+        ret[i].iov_base =
+            static_cast<const char *>(DataV[i].Base) + DataV[i].Offset;
+        ret[i].iov_len = DataV[i].Size;
+    }
+    ret[DataV.size()] = {NULL, 0};
+    return ret;
+}
+
+} // end namespace format
+} // end namespace adios2
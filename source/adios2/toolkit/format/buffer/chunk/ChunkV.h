@@ -0,0 +1,75 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * ChunkV.h
+ *
+ */
+
+#ifndef ADIOS2_TOOLKIT_FORMAT_BUFFER_CHUNK_CHUNKV_H_
+#define ADIOS2_TOOLKIT_FORMAT_BUFFER_CHUNK_CHUNKV_H_
+
+#include "adios2/toolkit/format/buffer/BufferV.h"
+
+#include <mutex>
+#include <vector>
+
+namespace adios2
+{
+namespace format
+{
+
+/** Thread-safe free list of fixed-size memory chunks, shared by the ChunkV
+ * buffers of consecutive steps so that chunk memory is allocated once and
+ * reused instead of being returned to the system after every step */
+class ChunkPool
+{
+public:
+    ChunkPool(const size_t chunkSize);
+    ~ChunkPool();
+
+    ChunkPool(const ChunkPool &) = delete;
+    ChunkPool &operator=(const ChunkPool &) = delete;
+
+    /** @return a chunk of ChunkSize() bytes, from the free list if possible
+     * @throws std::bad_alloc */
+    char *Get();
+
+    /** Hand a chunk obtained from Get() back to the free list */
+    void Release(char *chunk) noexcept;
+
+    size_t ChunkSize() const noexcept;
+
+private:
+    const size_t m_ChunkSize;
+    std::mutex m_Mutex;
+    std::vector<char *> m_FreeChunks;
+};
+
+/** BufferV that copies data into fixed-size chunks taken from a ChunkPool.
+ * The buffer never reallocates, data already copied is not moved when more
+ * is added, and a copied block larger than the free space of the current
+ * chunk continues in the next one. The chunks go back to the pool when the
+ * buffer is destroyed, i.e. after the step has been written. */
+class ChunkV : public BufferV
+{
+public:
+    ChunkV(const std::string type, ChunkPool &pool);
+    ~ChunkV();
+
+    BufferV_iovec DataVec() noexcept final;
+
+    size_t AddToVec(const size_t size, const void *buf, int align,
+                    bool CopyReqd) final;
+
+private:
+    ChunkPool &m_Pool;
+    std::vector<char *> m_Chunks;
+    /** bytes used in the last element of m_Chunks */
+    size_t m_TailPos = 0;
+};
+
+} // end namespace format
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_FORMAT_BUFFER_CHUNK_CHUNKV_H_ */
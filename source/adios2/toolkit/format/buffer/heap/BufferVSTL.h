@@ -0,0 +1,42 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * BufferVSTL.h
+ *
+ */
+
+#ifndef ADIOS2_TOOLKIT_FORMAT_BUFFER_HEAP_BUFFERVSTL_H_
+#define ADIOS2_TOOLKIT_FORMAT_BUFFER_HEAP_BUFFERVSTL_H_
+
+#include "adios2/toolkit/format/buffer/BufferV.h"
+#include "adios2/toolkit/format/buffer/heap/BufferSTL.h"
+
+namespace adios2
+{
+namespace format
+{
+
+/** BufferV that copies data into a single contiguous, growing BufferSTL.
+ * All copied data lands in one memory region, at the cost of a
+ * reallocation (and copy) whenever the block grows */
+class BufferVSTL : public BufferV
+{
+public:
+    BufferVSTL(const std::string type);
+    ~BufferVSTL() = default;
+
+    BufferV_iovec DataVec() noexcept final;
+
+    size_t AddToVec(const size_t size, const void *buf, int align,
+                    bool CopyReqd) final;
+
+private:
+    size_t m_internalPos = 0;
+    BufferSTL InternalBlock;
+};
+
+} // end namespace format
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_FORMAT_BUFFER_HEAP_BUFFERVSTL_H_ */
@@ -66,6 +66,15 @@ void CP_validateParams(SstStream Stream, SstParams Params, int Writer)
         {
             Params->DataTransport = strdup("rdma");
         }
+        else if ((strcmp(SelectedTransport, "shm") == 0) ||
+                 (strcmp(SelectedTransport, "sharedmemory") == 0))
+        {
+            Params->DataTransport = strdup("shm");
+        }
+        else
+        {
+            Params->DataTransport = strdup(SelectedTransport);
+        }
         free(SelectedTransport);
     }
     if (Params->ControlTransport == NULL)
@@ -167,7 +176,7 @@ void CP_validateParams(SstStream Stream, SstParams Params, int Writer)
 
 static char *SstRegStr[] = {"File", "Screen", "Cloud"};
 static char *SstMarshalStr[] = {"FFS", "BP", "BP5"};
-static char *SstQueueFullStr[] = {"Block", "Discard"};
+static char *SstQueueFullStr[] = {"Block", "Discard", "Spill"};
 static char *SstCompressStr[] = {"None", "ZFP"};
 static char *SstCommPatternStr[] = {"Min", "Peer"};
 static char *SstPreloadModeStr[] = {"Off", "On", "Auto"};
@@ -188,6 +197,12 @@ extern void CP_dumpParams(SstStream Stream, struct _SstParams *Params,
                 (Params->QueueLimit == 0) ? "(unlimited)" : "");
         fprintf(stderr, "Param -   QueueFullPolicy=%s\n",
                 SstQueueFullStr[Params->QueueFullPolicy]);
+        if (Params->QueueFullPolicy == SstQueueFullSpill)
+        {
+            fprintf(stderr, "Param -   SpillDirectory=%s\n",
+                    Params->SpillDirectory ? Params->SpillDirectory
+                                           : "(default, $TMPDIR or /tmp)");
+        }
     }
     fprintf(stderr, "Param -   DataTransport=%s\n",
             Params->DataTransport ? Params->DataTransport : "");
@@ -213,6 +228,8 @@ extern void CP_dumpParams(SstStream Stream, struct _SstParams *Params,
                 SstMarshalStr[Params->MarshalMethod]);
         fprintf(stderr, "Param -   FirstTimestepPrecious=%s\n",
                 Params->FirstTimestepPrecious ? "True" : "False");
+        fprintf(stderr, "Param -   ZeroCopyDeferredPuts=%s\n",
+                Params->ZeroCopyDeferredPuts ? "True" : "False");
         fprintf(stderr, "Param -   IsRowMajor=%d  (not user settable) \n",
                 Params->IsRowMajor);
     }
@@ -220,6 +237,7 @@ extern void CP_dumpParams(SstStream Stream, struct _SstParams *Params,
     {
         fprintf(stderr, "Param -   AlwaysProvideLatestTimestep=%s\n",
                 Params->AlwaysProvideLatestTimestep ? "True" : "False");
+        fprintf(stderr, "Param -   PrefetchDepth=%d\n", Params->PrefetchDepth);
     }
     fprintf(stderr, "Param -   OpenTimeoutSecs=%d (seconds)\n",
             Params->OpenTimeoutSecs);
@@ -1056,6 +1074,7 @@ extern void DoStreamSummary(SstStream Stream)
         AllStats[0].DataBytesReceived += AllStats[i].DataBytesReceived;
         AllStats[0].PreloadBytesReceived += AllStats[i].PreloadBytesReceived;
         AllStats[0].RunningFanIn += AllStats[i].RunningFanIn;
+        AllStats[0].TimestepsSpilled += AllStats[i].TimestepsSpilled;
     }
     AllStats[0].RunningFanIn /= Stream->CohortSize;
 
@@ -1069,6 +1088,12 @@ extern void DoStreamSummary(SstStream Stream)
                    Stream->Stats.TimestepsCreated);
         CP_verbose(Stream, SummaryVerbose, "\tTimesteps Delivered = %zu\n",
                    Stream->Stats.TimestepsDelivered);
+        if (AllStats[0].TimestepsSpilled)
+        {
+            CP_verbose(Stream, SummaryVerbose,
+                       "\tTimesteps Spilled (sum over ranks) = %zu\n",
+                       AllStats[0].TimestepsSpilled);
+        }
     }
     else if (Stream->Role == ReaderRole)
     {
@@ -1233,6 +1258,8 @@ extern void SstStreamDestroy(SstStream Stream)
         free(Stream->ConfigParams->DataInterface);
     if (Stream->ConfigParams->ControlModule)
         free(Stream->ConfigParams->ControlModule);
+    if (Stream->ConfigParams->SpillDirectory)
+        free(Stream->ConfigParams->SpillDirectory);
 
     if (Stream->Filename)
     {
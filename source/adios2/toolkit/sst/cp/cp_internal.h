@@ -126,6 +126,8 @@ typedef struct _CPTimestepEntry
     DataFreeFunc FreeTimestep;
     void *FreeClientData;
     void *DataBlockToFree;
+    char *GatheredData; /* data blocks copied together for the DP */
+    int Spilled; /* QueueFullPolicy Spill, data handed to the DP's file */
     struct _CPTimestepEntry *Next;
 } * CPTimestepList;
 
@@ -484,9 +486,9 @@ extern CP_Info CP_getCPInfo(CP_DP_Interface DPInfo, char *ControlModule);
 extern char *CP_GetContactString(SstStream s, attr_list DPAttrs);
 extern SstStream CP_newStream();
 extern void SstInternalProvideTimestep(
-    SstStream s, SstData LocalMetadata, SstData Data, long Timestep,
-    FFSFormatList Formats, DataFreeFunc FreeTimestep, void *FreeClientData,
-    SstData AttributeData, DataFreeFunc FreeAttributeData,
+    SstStream s, SstData LocalMetadata, SstData Data, int DataCount,
+    long Timestep, FFSFormatList Formats, DataFreeFunc FreeTimestep,
+    void *FreeClientData, SstData AttributeData, DataFreeFunc FreeAttributeData,
     void *FreeAttributeClientData);
 
 void **CP_consolidateDataToRankZero(SstStream stream, void *local_info,
@@ -527,6 +529,9 @@ extern void FFSMarshalInstallMetadata(SstStream Stream, TSMetadataMsg MetaData);
 extern void FFSMarshalInstallPreciousMetadata(SstStream Stream,
                                               TSMetadataMsg MetaData);
 extern void FFSClearTimestepData(SstStream Stream);
+extern void FFSPrefetchTimesteps(SstStream Stream, TSMetadataMsg *MetaData,
+                                 int Count);
+extern void FFSDiscardPrefetches(SstStream Stream, long Timestep);
 extern void FFSFreeMarshalData(SstStream Stream);
 extern void getPeerArrays(int MySize, int MyRank, int PeerSize,
                           int **forwardArray, int **reverseArray);
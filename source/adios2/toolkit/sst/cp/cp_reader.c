@@ -1264,6 +1264,10 @@ static void releasePriorTimesteps(SstStream Stream, long Latest)
                 Last->Next = Next;
             }
             STREAM_MUTEX_UNLOCK(Stream);
+            if (Stream->WriterConfigParams->MarshalMethod == SstMarshalFFS)
+            {
+                FFSDiscardPrefetches(Stream, This->MetadataMsg->Timestep);
+            }
             sendOneToEachWriterRank(
                 Stream, Stream->CPInfo->SharedCM->ReleaseTimestepFormat, &Msg,
                 &Msg.WSR_Stream);
@@ -1617,6 +1621,38 @@ extern void SstReaderDefinitionLock(SstStream Stream, long EffectiveTimestep)
         &Msg.WSR_Stream);
 }
 
+/*
+ * Start pulling data for the next PrefetchDepth timesteps whose metadata
+ * has already arrived, stopping at one that brings new formats.
+ */
+static void PrefetchNextTimesteps(SstStream Stream)
+{
+    struct _TimestepMetadataList *Next;
+    TSMetadataMsg *Msgs =
+        malloc(sizeof(TSMetadataMsg) * Stream->ConfigParams->PrefetchDepth);
+    int Count = 0;
+
+    STREAM_MUTEX_LOCK(Stream);
+    Next = Stream->Timesteps;
+    while (Next && (Count < Stream->ConfigParams->PrefetchDepth))
+    {
+        TSMetadataMsg Msg = Next->MetadataMsg;
+        if ((Msg->Timestep > Stream->ReaderTimestep) && Msg->Metadata)
+        {
+            if (Msg->Formats)
+            {
+                /* can't decode its metadata before it is installed */
+                break;
+            }
+            Msgs[Count++] = Msg;
+        }
+        Next = Next->Next;
+    }
+    STREAM_MUTEX_UNLOCK(Stream);
+    FFSPrefetchTimesteps(Stream, Msgs, Count);
+    free(Msgs);
+}
+
 //  SstReleaseStep is only called by the main program thread.  It
 //  locks to protect the timestep list before freeing the local
 //  representation of the resleased timestep.
@@ -1656,6 +1692,11 @@ extern void SstReleaseStep(SstStream Stream)
         Stream, PerRankVerbose,
         "Sending ReleaseTimestep message for timestep %d, one to each writer\n",
         Timestep);
+    if (Stream->WriterConfigParams->MarshalMethod == SstMarshalFFS)
+    {
+        /* unused prefetches of this step must land before the release */
+        FFSDiscardPrefetches(Stream, Timestep);
+    }
     sendOneToEachWriterRank(Stream,
                             Stream->CPInfo->SharedCM->ReleaseTimestepFormat,
                             &Msg, &Msg.WSR_Stream);
@@ -1663,6 +1704,11 @@ extern void SstReleaseStep(SstStream Stream)
     if (Stream->WriterConfigParams->MarshalMethod == SstMarshalFFS)
     {
         FFSClearTimestepData(Stream);
+        if ((Stream->ConfigParams->PrefetchDepth > 0) &&
+            !Stream->ConfigParams->AlwaysProvideLatestTimestep)
+        {
+            PrefetchNextTimesteps(Stream);
+        }
     }
     PERFSTUBS_TIMER_STOP_FUNC(timer);
 }
@@ -2237,6 +2283,10 @@ extern void SstReaderClose(SstStream Stream)
      * got received */
     struct timeval CloseTime, Diff;
     struct _ReaderCloseMsg Msg;
+    if (Stream->WriterConfigParams->MarshalMethod == SstMarshalFFS)
+    {
+        FFSDiscardPrefetches(Stream, LONG_MAX);
+    }
     /* wait until each reader rank has done SstReaderClose() */
     SMPI_Barrier(Stream->mpiComm);
     gettimeofday(&CloseTime, NULL);
@@ -287,11 +287,16 @@ static void RemoveQueueEntries(SstStream Stream)
                        ItemToFree->Timestep, ItemToFree->Expired,
                        ItemToFree->PreciousTimestep, ItemToFree->ReferenceCount,
                        Stream->QueuedTimestepCount);
-            ItemToFree->FreeTimestep(ItemToFree->FreeClientData);
+            if (ItemToFree->FreeTimestep)
+            {
+                /* not already freed by spilling */
+                ItemToFree->FreeTimestep(ItemToFree->FreeClientData);
+            }
             free(ItemToFree->Msg);
             //            free(ItemToFree->MetadataArray);
             //            free(ItemToFree->DP_TimestepInfo);
             free(ItemToFree->DataBlockToFree);
+            free(ItemToFree->GatheredData);
             free(ItemToFree);
             AnythingRemoved++;
 
@@ -422,6 +427,76 @@ static void QueueMaintenance(SstStream Stream)
     CP_verbose(Stream, PerRankVerbose, "QueueMaintenance complete\n");
 }
 
+/*
+SpillQueuedTimesteps:
+        QueueFullPolicy Spill.  While more than QueueLimit queued timesteps
+still have their data in memory, have the DP move the data of the oldest one
+to a file and free it.  Each rank spills its own data, the queue itself
+doesn't shrink.
+*/
+static void SpillQueuedTimesteps(SstStream Stream)
+{
+    const char *Directory = Stream->ConfigParams->SpillDirectory;
+
+    if (!Directory)
+    {
+        Directory = getenv("TMPDIR");
+    }
+    if (!Directory)
+    {
+        Directory = "/tmp";
+    }
+    STREAM_MUTEX_LOCK(Stream);
+    while (1)
+    {
+        CPTimestepList List = Stream->QueuedTimesteps;
+        CPTimestepList Oldest = NULL;
+        int InMemory = 0;
+        int Freed;
+
+        /* the queue is newest first */
+        while (List)
+        {
+            if (List->DPRegistered && !List->Expired && !List->Spilled)
+            {
+                InMemory++;
+                Oldest = List;
+            }
+            List = List->Next;
+        }
+        if (InMemory <= Stream->QueueLimit)
+        {
+            break;
+        }
+        /* tried at most once, if the DP can't it stays in memory */
+        Oldest->Spilled = 1;
+        Oldest->ReferenceCount++;
+        STREAM_MUTEX_UNLOCK(Stream);
+        Freed = Stream->DP_Interface->spillTimestep(
+            &Svcs, Stream->DP_Stream, Oldest->Timestep, Directory);
+        STREAM_MUTEX_LOCK(Stream);
+        if (Freed)
+        {
+            CP_verbose(Stream, PerRankVerbose,
+                       "Spilled the data of timestep %ld to %s\n",
+                       Oldest->Timestep, Directory);
+            Oldest->FreeTimestep(Oldest->FreeClientData);
+            Oldest->FreeTimestep = NULL;
+            Stream->Stats.TimestepsSpilled++;
+        }
+        else
+        {
+            CP_verbose(Stream, PerRankVerbose,
+                       "Timestep %ld could not be spilled, keeping it in "
+                       "memory\n",
+                       Oldest->Timestep);
+        }
+        Oldest->ReferenceCount--;
+    }
+    QueueMaintenance(Stream);
+    STREAM_MUTEX_UNLOCK(Stream);
+}
+
 /*
         Identify reader
         LOCK
@@ -1302,6 +1377,16 @@ SstStream SstWriterOpen(const char *Name, SstParams Params, SMPI_Comm comm)
         return NULL;
     }
 
+    if ((Stream->QueueFullPolicy == SstQueueFullSpill) &&
+        !Stream->DP_Interface->spillTimestep)
+    {
+        CP_verbose(Stream, CriticalVerbose,
+                   "DataPlane %s can't spill timesteps, using "
+                   "QueueFullPolicy Block instead\n",
+                   Stream->ConfigParams->DataTransport);
+        Stream->QueueFullPolicy = SstQueueFullBlock;
+    }
+
     Stream->CPInfo =
         CP_getCPInfo(Stream->DP_Interface, Stream->ConfigParams->ControlModule);
 
@@ -2097,9 +2182,9 @@ on reader close:
 
  */
 extern void SstInternalProvideTimestep(
-    SstStream Stream, SstData LocalMetadata, SstData Data, long Timestep,
-    FFSFormatList Formats, DataFreeFunc FreeTimestep, void *FreeClientData,
-    SstData AttributeData, DataFreeFunc FreeAttributeData,
+    SstStream Stream, SstData LocalMetadata, SstData Data, int DataCount,
+    long Timestep, FFSFormatList Formats, DataFreeFunc FreeTimestep,
+    void *FreeClientData, SstData AttributeData, DataFreeFunc FreeAttributeData,
     void *FreeAttributelientData)
 {
     void *data_block1, *data_block2;
@@ -2110,15 +2195,44 @@ extern void SstInternalProvideTimestep(
     struct _MetadataPlusDPInfo Md;
     CPTimestepList Entry = calloc(1, sizeof(struct _CPTimestepEntry));
     int PendingReaderCount = 0;
+    struct _SstData Gathered = {0, NULL};
 
     memset(Msg, 0, sizeof(*Msg));
     STREAM_MUTEX_LOCK(Stream);
     Stream->WriterTimestep = Timestep;
 
     STREAM_MUTEX_UNLOCK(Stream);
-    Stream->DP_Interface->provideTimestep(&Svcs, Stream->DP_Stream, Data,
-                                          LocalMetadata, Timestep,
-                                          &DP_TimestepInfo);
+    if (DataCount == 1)
+    {
+        Stream->DP_Interface->provideTimestep(&Svcs, Stream->DP_Stream, Data,
+                                              LocalMetadata, Timestep,
+                                              &DP_TimestepInfo);
+    }
+    else if (Stream->DP_Interface->provideTimestepV)
+    {
+        Stream->DP_Interface->provideTimestepV(&Svcs, Stream->DP_Stream, Data,
+                                               DataCount, LocalMetadata,
+                                               Timestep, &DP_TimestepInfo);
+    }
+    else
+    {
+        /* the DP wants a single block, copy the pieces together */
+        for (int i = 0; i < DataCount; i++)
+        {
+            Gathered.DataSize += Data[i].DataSize;
+        }
+        Gathered.block = malloc(Gathered.DataSize);
+        size_t Offset = 0;
+        for (int i = 0; i < DataCount; i++)
+        {
+            memcpy(Gathered.block + Offset, Data[i].block, Data[i].DataSize);
+            Offset += Data[i].DataSize;
+        }
+        Entry->GatheredData = Gathered.block;
+        Stream->DP_Interface->provideTimestep(&Svcs, Stream->DP_Stream,
+                                              &Gathered, LocalMetadata,
+                                              Timestep, &DP_TimestepInfo);
+    }
     if (Formats)
     {
         FFSFormatList tmp = Formats;
@@ -2137,7 +2251,12 @@ extern void SstInternalProvideTimestep(
 
     if (Data)
     {
-        PERFSTUBS_SAMPLE_COUNTER("Timestep local data size", Data->DataSize);
+        size_t DataSize = 0;
+        for (int i = 0; i < DataCount; i++)
+        {
+            DataSize += Data[i].DataSize;
+        }
+        PERFSTUBS_SAMPLE_COUNTER("Timestep local data size", DataSize);
     }
     if (LocalMetadata)
     {
@@ -2196,7 +2315,7 @@ extern void SstInternalProvideTimestep(
                 DiscardThisTimestep = 1;
             }
         }
-        else
+        else if (Stream->QueueFullPolicy == SstQueueFullBlock)
         {
             while ((Stream->QueueLimit > 0) &&
                    (Stream->QueuedTimestepCount > Stream->QueueLimit))
@@ -2322,6 +2441,11 @@ extern void SstInternalProvideTimestep(
         QueueMaintenance(Stream);
         STREAM_MUTEX_UNLOCK(Stream);
     }
+    if ((Stream->QueueFullPolicy == SstQueueFullSpill) &&
+        (Stream->QueueLimit > 0))
+    {
+        SpillQueuedTimesteps(Stream);
+    }
     while (PendingReaderCount--)
     {
         WS_ReaderInfo reader;
@@ -2406,7 +2530,7 @@ extern void SstProvideTimestep(SstStream Stream, SstData LocalMetadata,
                                DataFreeFunc FreeAttributeData,
                                void *FreeAttributeClientData)
 {
-    SstInternalProvideTimestep(Stream, LocalMetadata, Data, Timestep, NULL,
+    SstInternalProvideTimestep(Stream, LocalMetadata, Data, 1, Timestep, NULL,
                                FreeTimestep, FreeClientData, AttributeData,
                                FreeAttributeData, FreeAttributeClientData);
 }
@@ -2418,6 +2542,19 @@ extern void SstProvideTimestepMM(SstStream Stream, SstData LocalMetadata,
                                  DataFreeFunc FreeAttributeData,
                                  void *FreeAttributeClientData,
                                  struct _SstMetaMetaBlock *MMBlocks)
+{
+    SstProvideTimestepMMV(Stream, LocalMetadata, Data, 1, Timestep,
+                          FreeTimestep, FreeClientData, AttributeData,
+                          FreeAttributeData, FreeAttributeClientData, MMBlocks);
+}
+
+extern void SstProvideTimestepMMV(SstStream Stream, SstData LocalMetadata,
+                                  SstData Data, int DataCount, long Timestep,
+                                  DataFreeFunc FreeTimestep,
+                                  void *FreeClientData, SstData AttributeData,
+                                  DataFreeFunc FreeAttributeData,
+                                  void *FreeAttributeClientData,
+                                  struct _SstMetaMetaBlock *MMBlocks)
 {
     FFSFormatList Formats = NULL;
     while (MMBlocks && MMBlocks->BlockData)
@@ -2431,9 +2568,10 @@ extern void SstProvideTimestepMM(SstStream Stream, SstData LocalMetadata,
         Formats = New;
         MMBlocks++;
     }
-    SstInternalProvideTimestep(Stream, LocalMetadata, Data, Timestep, Formats,
-                               FreeTimestep, FreeClientData, AttributeData,
-                               FreeAttributeData, FreeAttributeClientData);
+    SstInternalProvideTimestep(Stream, LocalMetadata, Data, DataCount,
+                               Timestep, Formats, FreeTimestep, FreeClientData,
+                               AttributeData, FreeAttributeData,
+                               FreeAttributeClientData);
     while (Formats)
     {
         FFSFormatList Tmp = Formats->Next;
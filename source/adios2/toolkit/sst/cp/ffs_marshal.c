@@ -1,3 +1,4 @@
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -323,6 +324,7 @@ struct FFSMetadataInfoStruct
     size_t BitFieldCount;
     size_t *BitField;
     size_t DataBlockSize;
+    size_t DataBlockHeadSize; // encode header plus base record
 };
 
 static int FFSBitfieldTest(struct FFSMetadataInfoStruct *MBase, int Bit);
@@ -348,11 +350,14 @@ static void InitMarshalData(SstStream Stream)
                    "integer[BitFieldCount]", sizeof(size_t));
     AddSimpleField(&Info->MetaFields, &Info->MetaFieldCount, "DataBlockSize",
                    "integer", sizeof(size_t));
+    AddSimpleField(&Info->MetaFields, &Info->MetaFieldCount,
+                   "DataBlockHeadSize", "integer", sizeof(size_t));
     RecalcMarshalStorageSize(Stream);
     MBase = Stream->M;
     MBase->BitFieldCount = 0;
     MBase->BitField = malloc(sizeof(size_t));
     MBase->DataBlockSize = 0;
+    MBase->DataBlockHeadSize = 0;
 }
 
 extern void FFSFreeMarshalData(SstStream Stream)
@@ -406,6 +411,16 @@ extern void FFSFreeMarshalData(SstStream Stream)
                 free(Info->DataBaseAddrs);
             if (Info->DataFieldLists)
                 free(Info->DataFieldLists);
+            if (Info->CurReadPatterns)
+            {
+                for (int i = 0; i < Stream->WriterCohortSize; i++)
+                {
+                    free(Info->CurReadPatterns[i].Ranges);
+                    free(Info->PrevReadPatterns[i].Ranges);
+                }
+                free(Info->CurReadPatterns);
+                free(Info->PrevReadPatterns);
+            }
             for (int i = 0; i < Info->VarCount; i++)
             {
                 free(Info->VarList[i]->VarName);
@@ -416,6 +431,7 @@ extern void FFSFreeMarshalData(SstStream Stream)
                 free(Info->VarList[i]->PerWriterCounts);
                 free(Info->VarList[i]->PerWriterIncomingData);
                 free(Info->VarList[i]->PerWriterIncomingSize);
+                free(Info->VarList[i]->PerWriterDataBlockOffset);
                 free(Info->VarList[i]);
             }
             if (Info->VarList)
@@ -472,8 +488,8 @@ static FFSWriterRec CreateWriterRec(SstStream Stream, void *Variable,
     }
     else
     {
-        // Array field.  To Metadata, add FMFields for DimCount, Shape, Count
-        // and Offsets matching _MetaArrayRec
+        // Array field.  To Metadata, add FMFields for DimCount, Shape, Count,
+        // Offsets and DataBlockOffset matching _MetaArrayRec
         char *ArrayName = BuildArrayDimsName(Name, Type, ElemSize);
         char *ArrayDBCount = BuildArrayDBCountName(Name, Type, ElemSize);
         AddField(&Info->MetaFields, &Info->MetaFieldCount, ArrayName, Int64,
@@ -484,6 +500,7 @@ static FFSWriterRec CreateWriterRec(SstStream Stream, void *Variable,
         char *ShapeName = ConcatName(Name, "Shape");
         char *CountName = ConcatName(Name, "Count");
         char *OffsetsName = ConcatName(Name, "Offsets");
+        char *DataBlockOffsetName = ConcatName(Name, "DataBlockOffset");
         AddField(&Info->MetaFields, &Info->MetaFieldCount, ArrayDBCount, Int64,
                  sizeof(size_t));
         AddFixedArrayField(&Info->MetaFields, &Info->MetaFieldCount, ShapeName,
@@ -492,10 +509,13 @@ static FFSWriterRec CreateWriterRec(SstStream Stream, void *Variable,
                          Int64, sizeof(size_t), ArrayDBCount);
         AddVarArrayField(&Info->MetaFields, &Info->MetaFieldCount, OffsetsName,
                          Int64, sizeof(size_t), ArrayDBCount);
+        AddField(&Info->MetaFields, &Info->MetaFieldCount, DataBlockOffsetName,
+                 Int64, sizeof(size_t));
         free(ArrayDBCount);
         free(ShapeName);
         free(CountName);
         free(OffsetsName);
+        free(DataBlockOffsetName);
         RecalcMarshalStorageSize(Stream);
 
         if ((Stream->ConfigParams->CompressionMethod == SstCompressZFP) &&
@@ -537,6 +557,7 @@ typedef struct _MetaArrayRec
     size_t *Shape;   // Global dimensionality  [Dims]	NULL for local
     size_t *Count;   // Per-block Counts	  [DBCount]
     size_t *Offsets; // Per-block Offsets	  [DBCount]	NULL for local
+    size_t DataBlockOffset; // Offset of the array in the encoded data block
 } MetaArrayRec;
 
 typedef struct _FFSTimestepInfo
@@ -677,6 +698,8 @@ static FFSVarRec CreateVarRec(SstStream Stream, const char *ArrayName)
         calloc(sizeof(void *), Stream->WriterCohortSize);
     Ret->PerWriterIncomingSize =
         calloc(sizeof(size_t), Stream->WriterCohortSize);
+    Ret->PerWriterDataBlockOffset =
+        calloc(sizeof(size_t), Stream->WriterCohortSize);
     Info->VarList[Info->VarCount++] = Ret;
     return Ret;
 }
@@ -819,21 +842,334 @@ static int NeedWriter(FFSArrayRequest Req, int i)
     return 1;
 }
 
+/*
+ * When pulling only the needed parts of a data block beats pulling it
+ * whole depends on what a read costs on the data plane in use
+ */
+struct PartialReadHeuristics
+{
+    size_t CoalesceGap; // merge ranges less than this many bytes apart
+    int MaxRanges;      // pull whole block if more ranges than this remain
+    double MaxFraction; // pull whole block if ranges cover more than this
+};
+
+static void GetPartialReadHeuristics(SstStream Stream,
+                                     struct PartialReadHeuristics *H)
+{
+    const char *DP = Stream->ConfigParams->DataTransport;
+    static int ForcePartialReads = -1;
+    if (ForcePartialReads == -1)
+    {
+        ForcePartialReads = (getenv("SstForcePartialReads") != NULL);
+    }
+    if (ForcePartialReads)
+    {
+        /* for testing, pull the smallest ranges whatever they cost */
+        H->CoalesceGap = 0;
+        H->MaxRanges = INT_MAX;
+        H->MaxFraction = 1.0;
+    }
+    else if (DP && (strcmp(DP, "rdma") == 0))
+    {
+        /* one-sided reads, per-read overhead is small */
+        H->CoalesceGap = 16 * 1024;
+        H->MaxRanges = 64;
+        H->MaxFraction = 0.75;
+    }
+    else if (DP && (strcmp(DP, "shm") == 0))
+    {
+        /* node-local reads are a memcpy, every byte skipped is a win */
+        H->CoalesceGap = 4 * 1024;
+        H->MaxRanges = 256;
+        H->MaxFraction = 1.0;
+    }
+    else
+    {
+        /* evpath and others, every read is a message round trip */
+        H->CoalesceGap = 256 * 1024;
+        H->MaxRanges = 8;
+        H->MaxFraction = 0.5;
+    }
+}
+
+static int CompareReadRanges(const void *A, const void *B)
+{
+    const FFSReadRange *RA = A;
+    const FFSReadRange *RB = B;
+    if (RA->Start != RB->Start)
+    {
+        return (RA->Start < RB->Start) ? -1 : 1;
+    }
+    return (RA->End < RB->End) ? -1 : (RA->End > RB->End);
+}
+
+/* sorts and merges ranges less than Gap bytes apart, returns the new count */
+static int MergeReadRanges(FFSReadRange *Ranges, int Count, size_t Gap)
+{
+    int Merged = 0;
+    if (Count == 0)
+    {
+        return 0;
+    }
+    qsort(Ranges, Count, sizeof(Ranges[0]), CompareReadRanges);
+    for (int i = 1; i < Count; i++)
+    {
+        if (Ranges[i].Start <= Ranges[Merged].End + Gap)
+        {
+            if (Ranges[i].End > Ranges[Merged].End)
+            {
+                Ranges[Merged].End = Ranges[i].End;
+            }
+        }
+        else
+        {
+            Ranges[++Merged] = Ranges[i];
+        }
+    }
+    return Merged + 1;
+}
+
+/*
+ * Byte range of writer block data touched by one request, the span between
+ * the first and the last element of the intersection with the selection
+ */
+static int RequestDataRange(SstStream Stream, FFSArrayRequest Req, int Writer,
+                            FFSReadRange *Range)
+{
+    FFSVarRec VarRec = Req->VarRec;
+    size_t ArrayStart = VarRec->PerWriterDataBlockOffset[Writer];
+    size_t ElementSize = VarRec->ElementSize;
+    size_t DimCount = VarRec->DimCount;
+    size_t *RankSize = VarRec->PerWriterCounts[Writer];
+    size_t First = 0, Last = 0;
+
+    if (ArrayStart == 0)
+    {
+        return 0;
+    }
+    if (Req->RequestType == Local)
+    {
+        size_t LocalBlockID =
+            Req->BlockID - VarRec->PerWriterBlockStart[Writer];
+        size_t BlockElemCount;
+        for (size_t b = 0; b < LocalBlockID; b++)
+        {
+            First += CalcSize(DimCount, RankSize);
+            RankSize += DimCount;
+        }
+        BlockElemCount = CalcSize(DimCount, RankSize);
+        if (BlockElemCount == 0)
+        {
+            return 0;
+        }
+        Last = First + BlockElemCount - 1;
+    }
+    else
+    {
+        size_t *RankOffset = VarRec->PerWriterStart[Writer];
+        for (size_t k = 0; k < DimCount; k++)
+        {
+            /* row major: last dimension is fastest, column major: first */
+            size_t j = Stream->ConfigParams->IsRowMajor ? k : DimCount - 1 - k;
+            size_t Lo = Req->Start[j] > RankOffset[j] ? Req->Start[j]
+                                                      : RankOffset[j];
+            size_t SelEnd = Req->Start[j] + Req->Count[j];
+            size_t RankEnd = RankOffset[j] + RankSize[j];
+            size_t Hi = (SelEnd < RankEnd ? SelEnd : RankEnd) - 1;
+            First = First * RankSize[j] + (Lo - RankOffset[j]);
+            Last = Last * RankSize[j] + (Hi - RankOffset[j]);
+        }
+    }
+    Range->Start = ArrayStart + First * ElementSize;
+    Range->End = ArrayStart + (Last + 1) * ElementSize;
+    return 1;
+}
+
+/*
+ * Plans the reads from one writer's data block: the encoded base record
+ * plus the parts of the arrays that the requests touch, coalesced.
+ * Returns the number of ranges, or 0 if the whole block should be pulled.
+ */
+static int PlanPartialReads(SstStream Stream, FFSArrayRequest Reqs, int Writer,
+                            FFSReadRange **RangesP)
+{
+    struct FFSReaderMarshalBase *Info = Stream->ReaderMarshalData;
+    struct FFSMetadataInfoStruct *MBase = Info->MetadataBaseAddrs[Writer];
+    struct PartialReadHeuristics H;
+    FFSReadRange *Ranges;
+    int Count = 0;
+    size_t Total = 0;
+
+    if ((MBase->DataBlockHeadSize == 0) ||
+        (Stream->WriterConfigParams->CompressionMethod == SstCompressZFP))
+    {
+        return 0;
+    }
+    GetPartialReadHeuristics(Stream, &H);
+
+    Ranges = malloc(sizeof(Ranges[0]));
+    Ranges[Count].Start = 0;
+    Ranges[Count].End = MBase->DataBlockHeadSize;
+    Count++;
+    for (FFSArrayRequest Req = Reqs; Req; Req = Req->Next)
+    {
+        if (!NeedWriter(Req, Writer))
+        {
+            continue;
+        }
+        Ranges = realloc(Ranges, sizeof(Ranges[0]) * (Count + 1));
+        if (!RequestDataRange(Stream, Req, Writer, &Ranges[Count]) ||
+            (Ranges[Count].End > MBase->DataBlockSize))
+        {
+            free(Ranges);
+            return 0;
+        }
+        Count++;
+    }
+
+    Count = MergeReadRanges(Ranges, Count, H.CoalesceGap);
+    for (int i = 0; i < Count; i++)
+    {
+        Total += Ranges[i].End - Ranges[i].Start;
+    }
+    if ((Count > H.MaxRanges) ||
+        ((double)Total > H.MaxFraction * (double)MBase->DataBlockSize))
+    {
+        free(Ranges);
+        return 0;
+    }
+    *RangesP = Ranges;
+    return Count;
+}
+
+static void AppendReadPattern(FFSReadPattern *Pattern, size_t DataSize,
+                              const FFSReadRange *Ranges, int Count)
+{
+    Pattern->DataSize = DataSize;
+    Pattern->Ranges = realloc(Pattern->Ranges,
+                              sizeof(Ranges[0]) *
+                                  (Pattern->RangeCount + Count));
+    memcpy(Pattern->Ranges + Pattern->RangeCount, Ranges,
+           sizeof(Ranges[0]) * Count);
+    Pattern->RangeCount += Count;
+}
+
+/* true if every range is inside one of the (merged) pattern ranges */
+static int PatternCovers(const FFSReadPattern *Pattern,
+                         const FFSReadRange *Ranges, int Count)
+{
+    for (int i = 0; i < Count; i++)
+    {
+        int Covered = 0;
+        for (int j = 0; j < Pattern->RangeCount; j++)
+        {
+            if ((Pattern->Ranges[j].Start <= Ranges[i].Start) &&
+                (Ranges[i].End <= Pattern->Ranges[j].End))
+            {
+                Covered = 1;
+                break;
+            }
+        }
+        if (!Covered)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static FFSPrefetch TakePrefetch(struct FFSReaderMarshalBase *Info,
+                                long Timestep, int Writer)
+{
+    FFSPrefetch *Link = &Info->Prefetches;
+    while (*Link)
+    {
+        FFSPrefetch P = *Link;
+        if ((P->Timestep == Timestep) && (P->WriterRank == Writer))
+        {
+            *Link = P->Next;
+            return P;
+        }
+        Link = &P->Next;
+    }
+    return NULL;
+}
+
+static void DiscardPrefetch(SstStream Stream, FFSPrefetch P)
+{
+    /* reads in flight still target the buffer, let them land first */
+    for (int r = 0; r < P->Pattern.RangeCount; r++)
+    {
+        SstWaitForCompletion(Stream, P->Handles[r]);
+    }
+    free(P->Handles);
+    free(P->Buffer);
+    free(P->Pattern.Ranges);
+    free(P);
+}
+
+/*
+ * Hands ranges of this timestep that were pulled ahead over to the
+ * WriterInfo, if they cover everything that is needed now.  Returns 1 if
+ * they did, otherwise drops them and returns 0.
+ */
+static int UsePrefetch(SstStream Stream, int Writer, size_t DataSize,
+                       const FFSReadRange *Ranges, int RangeCount)
+{
+    struct FFSReaderMarshalBase *Info = Stream->ReaderMarshalData;
+    FFSReaderPerWriterRec *WriterInfo = &Info->WriterInfo[Writer];
+    FFSPrefetch P = TakePrefetch(Info, Stream->ReaderTimestep, Writer);
+
+    if (!P)
+    {
+        return 0;
+    }
+    if ((P->Pattern.DataSize != DataSize) ||
+        !PatternCovers(&P->Pattern, Ranges, RangeCount))
+    {
+        CP_verbose(Stream, TraceVerbose,
+                   "Prefetched data from writer rank %d doesn't cover the "
+                   "requests of timestep %ld, pulling again\n",
+                   Writer, P->Timestep);
+        DiscardPrefetch(Stream, P);
+        return 0;
+    }
+    CP_verbose(Stream, TraceVerbose,
+               "Using prefetched data from writer rank %d for timestep %ld\n",
+               Writer, P->Timestep);
+    free(WriterInfo->RawBuffer);
+    WriterInfo->RawBuffer = P->Buffer;
+    WriterInfo->ReadHandles = P->Handles;
+    WriterInfo->ReadHandleCount = P->Pattern.RangeCount;
+    free(P->Pattern.Ranges);
+    free(P);
+    return 1;
+}
+
 static void IssueReadRequests(SstStream Stream, FFSArrayRequest Reqs)
 {
     struct FFSReaderMarshalBase *Info = Stream->ReaderMarshalData;
     SstFullMetadata Mdata = Stream->CurrentMetadata;
+    FFSArrayRequest Req = Reqs;
 
-    while (Reqs)
+    if ((Stream->ConfigParams->PrefetchDepth > 0) && !Info->CurReadPatterns)
+    {
+        /* record what gets read, FFSPrefetchTimesteps repeats it */
+        Info->CurReadPatterns =
+            calloc(Stream->WriterCohortSize, sizeof(FFSReadPattern));
+        Info->PrevReadPatterns =
+            calloc(Stream->WriterCohortSize, sizeof(FFSReadPattern));
+    }
+    while (Req)
     {
         for (int i = 0; i < Stream->WriterCohortSize; i++)
         {
-            if ((Info->WriterInfo[i].Status != Needed) && (NeedWriter(Reqs, i)))
+            if ((Info->WriterInfo[i].Status != Needed) && (NeedWriter(Req, i)))
             {
                 Info->WriterInfo[i].Status = Needed;
             }
         }
-        Reqs = Reqs->Next;
+        Req = Req->Next;
     }
 
     for (int i = 0; i < Stream->WriterCohortSize; i++)
@@ -845,15 +1181,57 @@ static void IssueReadRequests(SstStream Stream, FFSArrayRequest Reqs)
                     ->DataBlockSize;
             void *DP_TimestepInfo =
                 Mdata->DP_TimestepInfo ? Mdata->DP_TimestepInfo[i] : NULL;
+            FFSReadRange WholeBlock = {0, DataSize};
+            FFSReadRange *Ranges = NULL;
+            int RangeCount = PlanPartialReads(Stream, Reqs, i, &Ranges);
+            size_t RequestedSize = 0;
+
+            if (RangeCount == 0)
+            {
+                Ranges = &WholeBlock;
+                RangeCount = 1;
+            }
+            if (Info->CurReadPatterns)
+            {
+                AppendReadPattern(&Info->CurReadPatterns[i], DataSize, Ranges,
+                                  RangeCount);
+            }
+            if (Info->Prefetches &&
+                UsePrefetch(Stream, i, DataSize, Ranges, RangeCount))
+            {
+                if (Ranges != &WholeBlock)
+                {
+                    free(Ranges);
+                }
+                Info->WriterInfo[i].Status = Requested;
+                continue;
+            }
             Info->WriterInfo[i].RawBuffer =
                 realloc(Info->WriterInfo[i].RawBuffer, DataSize);
+            Info->WriterInfo[i].ReadHandles =
+                malloc(RangeCount * sizeof(DP_CompletionHandle));
+            for (int r = 0; r < RangeCount; r++)
+            {
+                size_t Length = Ranges[r].End - Ranges[r].Start;
+                Info->WriterInfo[i].ReadHandles[r] = SstReadRemoteMemory(
+                    Stream, i, Stream->ReaderTimestep, Ranges[r].Start, Length,
+                    Info->WriterInfo[i].RawBuffer + Ranges[r].Start,
+                    DP_TimestepInfo);
+                RequestedSize += Length;
+            }
+            Info->WriterInfo[i].ReadHandleCount = RangeCount;
+            CP_verbose(Stream, TraceVerbose,
+                       "Pulling %zu of %zu bytes from writer rank %d in %d "
+                       "read(s)\n",
+                       RequestedSize, DataSize, i, RangeCount);
+            if (Ranges != &WholeBlock)
+            {
+                free(Ranges);
+            }
 
             char tmpstr[256] = {0};
             sprintf(tmpstr, "Request to rank %d, bytes", i);
-            PERFSTUBS_SAMPLE_COUNTER(tmpstr, (double)DataSize);
-            Info->WriterInfo[i].ReadHandle = SstReadRemoteMemory(
-                Stream, i, Stream->ReaderTimestep, 0, DataSize,
-                Info->WriterInfo[i].RawBuffer, DP_TimestepInfo);
+            PERFSTUBS_SAMPLE_COUNTER(tmpstr, (double)RequestedSize);
             Info->WriterInfo[i].Status = Requested;
         }
     }
@@ -956,8 +1334,20 @@ static SstStatusValue WaitForReadRequests(SstStream Stream)
     {
         if (Info->WriterInfo[i].Status == Requested)
         {
-            SstStatusValue Result =
-                SstWaitForCompletion(Stream, Info->WriterInfo[i].ReadHandle);
+            SstStatusValue Result = SstSuccess;
+            for (int r = 0; r < Info->WriterInfo[i].ReadHandleCount; r++)
+            {
+                /* wait for all, a failed handle still has to be reaped */
+                SstStatusValue R = SstWaitForCompletion(
+                    Stream, Info->WriterInfo[i].ReadHandles[r]);
+                if (R != SstSuccess)
+                {
+                    Result = R;
+                }
+            }
+            free(Info->WriterInfo[i].ReadHandles);
+            Info->WriterInfo[i].ReadHandles = NULL;
+            Info->WriterInfo[i].ReadHandleCount = 0;
             if (Result == SstSuccess)
             {
                 Info->WriterInfo[i].Status = Full;
@@ -1420,6 +1810,143 @@ static void FillReadRequests(SstStream Stream, FFSArrayRequest Reqs)
     }
 }
 
+/*
+ * Size of a writer's data block in a timestep that is not installed yet.
+ * Returns 0 if the metadata can't be decoded without installing it.
+ */
+static size_t PeekDataBlockSize(SstStream Stream, TSMetadataMsg MetaData,
+                                int Writer)
+{
+    char *Block = MetaData->Metadata[Writer].block;
+    FFSTypeHandle FFSformat;
+    size_t DataBlockSize;
+    void *BaseData;
+
+    if (!Block)
+    {
+        return 0;
+    }
+    FFSformat = FFSTypeHandle_from_encode(Stream->ReaderFFSContext, Block);
+    if (!FFSformat || !FFShas_conversion(FFSformat))
+    {
+        return 0;
+    }
+    /* decode a copy, the block itself is decoded in place on install */
+    BaseData = malloc(FFS_est_decode_length(
+        Stream->ReaderFFSContext, Block, MetaData->Metadata[Writer].DataSize));
+    FFSdecode_to_buffer(Stream->ReaderFFSContext, Block, BaseData);
+    DataBlockSize = ((struct FFSMetadataInfoStruct *)BaseData)->DataBlockSize;
+    free(BaseData);
+    return DataBlockSize;
+}
+
+extern void FFSDiscardPrefetches(SstStream Stream, long Timestep)
+{
+    struct FFSReaderMarshalBase *Info = Stream->ReaderMarshalData;
+    if (!Info)
+    {
+        return;
+    }
+    FFSPrefetch *Link = &Info->Prefetches;
+    while (*Link)
+    {
+        FFSPrefetch P = *Link;
+        if (P->Timestep <= Timestep)
+        {
+            *Link = P->Next;
+            DiscardPrefetch(Stream, P);
+        }
+        else
+        {
+            Link = &P->Next;
+        }
+    }
+}
+
+/*
+ * Pulls the ranges read from each writer in the timestep just released
+ * for the given queued timesteps, without waiting for the reads.  They are
+ * picked up by IssueReadRequests when those timesteps become current.
+ */
+extern void FFSPrefetchTimesteps(SstStream Stream, TSMetadataMsg *MetaData,
+                                 int Count)
+{
+    struct FFSReaderMarshalBase *Info = Stream->ReaderMarshalData;
+    if (!Info || !Info->CurReadPatterns ||
+        Stream->ConfigParams->ReaderShortCircuitReads)
+    {
+        return;
+    }
+    for (int i = 0; i < Stream->WriterCohortSize; i++)
+    {
+        FFSReadPattern Tmp = Info->PrevReadPatterns[i];
+        Info->PrevReadPatterns[i] = Info->CurReadPatterns[i];
+        Info->PrevReadPatterns[i].RangeCount =
+            MergeReadRanges(Info->PrevReadPatterns[i].Ranges,
+                            Info->PrevReadPatterns[i].RangeCount, 0);
+        Tmp.RangeCount = 0;
+        Info->CurReadPatterns[i] = Tmp;
+    }
+
+    for (int t = 0; t < Count; t++)
+    {
+        TSMetadataMsg Msg = MetaData[t];
+        if (Msg->PreloadMode != SstPreloadNone)
+        {
+            /* the writer is pushing this timestep already */
+            continue;
+        }
+        for (int i = 0; i < Stream->WriterCohortSize; i++)
+        {
+            FFSReadPattern *Pattern = &Info->PrevReadPatterns[i];
+            FFSPrefetch P;
+            if (Pattern->RangeCount == 0)
+            {
+                continue;
+            }
+            P = TakePrefetch(Info, Msg->Timestep, i);
+            if (P)
+            {
+                /* already in flight, put it back */
+                P->Next = Info->Prefetches;
+                Info->Prefetches = P;
+                continue;
+            }
+            if (PeekDataBlockSize(Stream, Msg, i) != Pattern->DataSize)
+            {
+                /* layout changed, or can't tell */
+                continue;
+            }
+            P = calloc(1, sizeof(*P));
+            P->Timestep = Msg->Timestep;
+            P->WriterRank = i;
+            P->Pattern.DataSize = Pattern->DataSize;
+            P->Pattern.RangeCount = Pattern->RangeCount;
+            P->Pattern.Ranges =
+                malloc(sizeof(Pattern->Ranges[0]) * Pattern->RangeCount);
+            memcpy(P->Pattern.Ranges, Pattern->Ranges,
+                   sizeof(Pattern->Ranges[0]) * Pattern->RangeCount);
+            P->Buffer = malloc(Pattern->DataSize);
+            P->Handles =
+                malloc(sizeof(DP_CompletionHandle) * Pattern->RangeCount);
+            for (int r = 0; r < Pattern->RangeCount; r++)
+            {
+                P->Handles[r] = SstReadRemoteMemory(
+                    Stream, i, Msg->Timestep, Pattern->Ranges[r].Start,
+                    Pattern->Ranges[r].End - Pattern->Ranges[r].Start,
+                    P->Buffer + Pattern->Ranges[r].Start,
+                    Msg->DP_TimestepInfo ? Msg->DP_TimestepInfo[i] : NULL);
+            }
+            CP_verbose(Stream, TraceVerbose,
+                       "Prefetching %d range(s) of timestep %ld from writer "
+                       "rank %d\n",
+                       Pattern->RangeCount, (long)Msg->Timestep, i);
+            P->Next = Info->Prefetches;
+            Info->Prefetches = P;
+        }
+    }
+}
+
 extern SstStatusValue SstFFSPerformGets(SstStream Stream)
 {
     struct FFSReaderMarshalBase *Info = Stream->ReaderMarshalData;
@@ -1445,6 +1972,40 @@ extern SstStatusValue SstFFSPerformGets(SstStream Stream)
     return Ret;
 }
 
+/*
+ * Records in the metadata where each array landed in the encoded data
+ * block, so that readers can pull only the parts they need.  In the
+ * encoded block the base record follows the FFS header (as sized by
+ * FFSheader_size(), the data format always has variant parts) and the
+ * array pointers in it are offsets from the start of the base record.
+ */
+static void RecordDataBlockOffsets(SstStream Stream, char *Block)
+{
+    struct FFSWriterMarshalBase *Info = Stream->WriterMarshalData;
+    struct FFSMetadataInfoStruct *MBase = Stream->M;
+    int IDLength;
+    size_t HeaderSize;
+
+    get_server_ID_FMformat(Info->DataFormat, &IDLength);
+    HeaderSize = IDLength + sizeof(int);
+    HeaderSize += (8 - HeaderSize) & 0x7;
+    MBase->DataBlockHeadSize =
+        HeaderSize + FMstruct_size_field_list(Info->DataFields, sizeof(char *));
+
+    for (int i = 0; i < Info->RecCount; i++)
+    {
+        FFSWriterRec Rec = &Info->RecList[i];
+        if ((Rec->DimCount == 0) || !FFSBitfieldTest(MBase, Rec->FieldID))
+        {
+            continue;
+        }
+        ArrayRec *Encoded = (ArrayRec *)(Block + HeaderSize + Rec->DataOffset);
+        MetaArrayRec *MetaEntry =
+            (MetaArrayRec *)((char *)(Stream->M) + Rec->MetaOffset);
+        MetaEntry->DataBlockOffset = HeaderSize + (size_t)Encoded->Array;
+    }
+}
+
 extern void SstFFSWriterEndStep(SstStream Stream, size_t Timestep)
 {
     struct FFSWriterMarshalBase *Info;
@@ -1567,6 +2128,11 @@ extern void SstFFSWriterEndStep(SstStream Stream, size_t Timestep)
 
     MBase = Stream->M;
     MBase->DataBlockSize = DataSize;
+    MBase->DataBlockHeadSize = 0;
+    if (DataRec.block)
+    {
+        RecordDataBlockOffsets(Stream, DataRec.block);
+    }
     MetaDataRec.block =
         FFSencode(MetaEncodeBuffer, Info->MetaFormat, Stream->M, &MetaDataSize);
     MetaDataRec.DataSize = MetaDataSize;
@@ -1616,7 +2182,7 @@ extern void SstFFSWriterEndStep(SstStream Stream, size_t Timestep)
 
     PERFSTUBS_TIMER_STOP(timer);
 
-    SstInternalProvideTimestep(Stream, &MetaDataRec, &DataRec, Timestep,
+    SstInternalProvideTimestep(Stream, &MetaDataRec, &DataRec, 1, Timestep,
                                Formats, FreeTSInfo, TSInfo, &AttributeRec,
                                FreeAttrInfo, AttributeEncodeBuffer);
     if (AttributeEncodeBuffer)
@@ -1812,7 +2378,7 @@ static struct ControlInfo *BuildControl(SstStream Stream, FMFormat Format)
                 VarRec->ElementSize = ElementSize;
                 C->ElementSize = ElementSize;
             }
-            i += 5; // number of fields in MetaArrayRec
+            i += 6; // number of fields in MetaArrayRec
             free(ArrayName);
             C->VarRec = VarRec;
         }
@@ -1998,6 +2564,8 @@ static void BuildVarList(SstStream Stream, TSMetadataMsg MetaData,
                 meta_base->Dims ? meta_base->DBCount / meta_base->Dims : 1;
             VarRec->PerWriterStart[WriterRank] = meta_base->Offsets;
             VarRec->PerWriterCounts[WriterRank] = meta_base->Count;
+            VarRec->PerWriterDataBlockOffset[WriterRank] =
+                meta_base->DataBlockOffset;
             if (WriterRank == 0)
             {
                 VarRec->PerWriterBlockStart[WriterRank] = 0;
@@ -63,6 +63,7 @@ typedef struct FFSVarRec
     size_t **PerWriterCounts;
     void **PerWriterIncomingData;
     size_t *PerWriterIncomingSize; // important for compression
+    size_t *PerWriterDataBlockOffset; // where the array is in the data block
 } * FFSVarRec;
 
 enum FFSRequestTypeEnum
@@ -94,7 +95,8 @@ typedef struct FFSReaderPerWriterRec
 {
     enum WriterDataStatusEnum Status;
     char *RawBuffer;
-    DP_CompletionHandle ReadHandle;
+    int ReadHandleCount;
+    DP_CompletionHandle *ReadHandles;
 } FFSReaderPerWriterRec;
 
 struct ControlStruct
@@ -115,6 +117,31 @@ struct ControlInfo
     struct ControlStruct Controls[1];
 };
 
+typedef struct _FFSReadRange
+{
+    size_t Start;
+    size_t End; // one past the last byte
+} FFSReadRange;
+
+/* the ranges pulled from one writer's data block during a timestep */
+typedef struct _FFSReadPattern
+{
+    size_t DataSize;
+    int RangeCount;
+    FFSReadRange *Ranges;
+} FFSReadPattern;
+
+/* ranges of a later timestep pulled ahead of time, see PrefetchDepth */
+typedef struct _FFSPrefetch
+{
+    long Timestep;
+    int WriterRank;
+    FFSReadPattern Pattern;
+    char *Buffer;
+    DP_CompletionHandle *Handles;
+    struct _FFSPrefetch *Next;
+} * FFSPrefetch;
+
 struct FFSReaderMarshalBase
 {
     int VarCount;
@@ -130,6 +157,10 @@ struct FFSReaderMarshalBase
 
     FFSReaderPerWriterRec *WriterInfo;
     struct ControlInfo *ControlBlocks;
+
+    FFSReadPattern *CurReadPatterns;  // per writer, this timestep
+    FFSReadPattern *PrevReadPatterns; // per writer, last timestep
+    FFSPrefetch Prefetches;
 };
 
 extern char *FFS_ZFPCompress(SstStream Stream, const size_t DimCount, int Type,
@@ -17,6 +17,7 @@ extern CP_DP_Interface LoadRdmaDP();
 extern CP_DP_Interface LoadDaosDP();
 #endif /* SST_HAVE_LIBFABRIC */
 extern CP_DP_Interface LoadEVpathDP();
+extern CP_DP_Interface LoadShmDP();
 
 typedef struct _DPElement
 {
@@ -58,6 +59,7 @@ CP_DP_Interface SelectDP(CP_Services Svcs, void *CP_Stream,
     DPlist List = NULL;
     List = AddDPPossibility(Svcs, CP_Stream, List, LoadEVpathDP(), "evpath",
                             Params);
+    List = AddDPPossibility(Svcs, CP_Stream, List, LoadShmDP(), "shm", Params);
 #ifdef SST_HAVE_LIBFABRIC
     List =
         AddDPPossibility(Svcs, CP_Stream, List, LoadRdmaDP(), "rdma", Params);
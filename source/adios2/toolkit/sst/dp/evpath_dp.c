@@ -1,9 +1,13 @@
 #include <assert.h>
+#include <errno.h>
 #include <limits.h>
 #include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <unistd.h>
 
 #include <atl.h>
 #include <evpath.h>
@@ -57,6 +61,14 @@
  *   accomplished using the connections and message delivery facilities of
  *   the control plane, made available here via CP_Services.  A real data
  *   plane would replace one or both of these with RDMA functionality.
+ *
+ *   The "shm" data plane is this one with a node-local shortcut.  The
+ *   writer copies each timestep's data block into a System V shared memory
+ *   segment and sends its id and host name as per-timestep DP info.  A
+ *   reader on the same host attaches the segment and satisfies
+ *   ReadRemoteMemory with a memcpy, other readers (or a failed attach) use
+ *   the regular request/reply messages.  Preloading is disabled in that
+ *   mode, so both sides must select "shm".
  */
 
 typedef struct _Evpath_RS_Stream
@@ -83,6 +95,11 @@ typedef struct _Evpath_RS_Stream
     long ReadRequestsFromPreload;
     SstStats Stats;
     long LastPreloadTimestep;
+
+    /* shm data plane */
+    int UseShm;
+    char *HostName;
+    struct _RSShmSegment *ShmSegments;
 } * Evpath_RS_Stream;
 
 typedef struct _Evpath_WSR_Stream
@@ -101,9 +118,14 @@ typedef struct _Evpath_WSR_Stream
 typedef struct _TimestepEntry
 {
     long Timestep;
-    struct _SstData Data;
+    struct _SstData Data; /* total size, block only if DataCount is 1 */
+    struct _SstData *DataVec;
+    int DataCount;
     struct _EvpathPerTimestepInfo *DP_TimestepInfo;
     struct _ReaderRequestTrackRec *ReaderRequests;
+    char *ShmAddr; /* attached shm copy of Data, shm data plane only */
+    int SpillFD;   /* unlinked file holding the data once spilled, or -1 */
+    int ReadsInFlight; /* replies being sent from DataVec, blocks spilling */
     struct _TimestepEntry *Next;
 } * TimestepList;
 
@@ -117,6 +139,15 @@ typedef struct _RSTimestepEntry
     struct _RSTimestepEntry *Next;
 } * RSTimestepList;
 
+/* a writer's shm segment attached by a reader, shm data plane only */
+typedef struct _RSShmSegment
+{
+    long Timestep;
+    int WriterRank;
+    char *Addr;
+    struct _RSShmSegment *Next;
+} * RSShmSegmentList;
+
 typedef struct _ReaderRequestTrackRec
 {
     Evpath_WSR_Stream Reader;
@@ -138,6 +169,10 @@ typedef struct _Evpath_WS_Stream
     int ReaderCount;
     Evpath_WSR_Stream *Readers;
     SstStats Stats;
+
+    /* shm data plane */
+    int UseShm;
+    char *HostName;
 } * Evpath_WS_Stream;
 
 typedef struct _EvpathReaderContactInfo
@@ -153,6 +188,12 @@ typedef struct _EvpathWriterContactInfo
     void *WS_Stream;
 } * EvpathWriterContactInfo;
 
+typedef struct _EvpathPerTimestepInfo
+{
+    char *HostName;
+    int ShmId;
+} * EvpathPerTimestepInfo;
+
 typedef struct _EvpathReadRequestMsg
 {
     long Timestep;
@@ -246,12 +287,33 @@ static void EvpathPreloadHandler(CManager cm, CMConnection conn, void *msg_v,
                                  void *client_Data, attr_list attrs);
 static void DiscardPriorPreloaded(CP_Services Svcs, Evpath_RS_Stream RS_Stream,
                                   long Timestep);
+static void DetachShmSegments(CP_Services Svcs, Evpath_RS_Stream RS_Stream,
+                              long Timestep);
+static void FreeTimestepInfo(TimestepList Entry);
 static void SendPreloadMsgs(CP_Services Svcs, Evpath_WSR_Stream WSR_Stream,
                             TimestepList TS);
 static void SendSpeculativePreloadMsgs(CP_Services Svcs,
                                        Evpath_WSR_Stream WSR_Stream,
                                        TimestepList TS);
 
+/* the shm data plane is this one, selected as "shm" */
+static int UseShmDP(struct _SstParams *Params)
+{
+    return Params->DataTransport &&
+           (strcmp(Params->DataTransport, "shm") == 0);
+}
+
+static char *GetHostName()
+{
+    char HostName[256];
+    if (gethostname(HostName, sizeof(HostName)) != 0)
+    {
+        return strdup("");
+    }
+    HostName[sizeof(HostName) - 1] = 0;
+    return strdup(HostName);
+}
+
 // reader-side routine, called by the main thread
 static DP_RS_Stream EvpathInitReader(CP_Services Svcs, void *CP_Stream,
                                      void **ReaderContactInfoPtr,
@@ -277,6 +339,11 @@ static DP_RS_Stream EvpathInitReader(CP_Services Svcs, void *CP_Stream,
     Stream->CP_Stream = CP_Stream;
     Stream->Stats = Stats;
     Stream->LastPreloadTimestep = -1;
+    Stream->UseShm = UseShmDP(Params);
+    if (Stream->UseShm)
+    {
+        Stream->HostName = GetHostName();
+    }
 
     pthread_mutex_init(&Stream->DataLock, NULL);
 
@@ -339,7 +406,9 @@ static void EvpathDestroyReader(CP_Services Svcs, DP_RS_Stream RS_Stream_v)
     Evpath_RS_Stream RS_Stream = (Evpath_RS_Stream)RS_Stream_v;
     pthread_mutex_lock(&RS_Stream->DataLock);
     DiscardPriorPreloaded(Svcs, RS_Stream, LONG_MAX);
+    DetachShmSegments(Svcs, RS_Stream, LONG_MAX);
     pthread_mutex_unlock(&RS_Stream->DataLock);
+    free(RS_Stream->HostName);
     for (int i = 0; i < RS_Stream->WriterCohortSize; i++)
     {
         free(RS_Stream->WriterContactInfo[i].ContactString);
@@ -378,6 +447,66 @@ static void MarkReadRequest(TimestepList TS, DP_WSR_Stream WSR_Stream_v,
     TS->ReaderRequests = ReqTrk;
 }
 
+/*
+ * Returns Length bytes at Offset of a timestep's data.  Those that lie in
+ * one of its blocks are returned in place, others are copied together into
+ * *ToFree, which the caller frees when done.  Spilled data is read back from
+ * its file into *ToFree.
+ */
+static char *TimestepDataRange(TimestepList TS, size_t Offset, size_t Length,
+                               char **ToFree)
+{
+    int i = 0;
+    size_t Copied = 0;
+    char *Gathered;
+
+    *ToFree = NULL;
+    if (TS->SpillFD != -1)
+    {
+        Gathered = malloc(Length);
+        while (Copied < Length)
+        {
+            ssize_t Got = pread(TS->SpillFD, Gathered + Copied,
+                                Length - Copied, Offset + Copied);
+            if (Got <= 0)
+            {
+                if ((Got == -1) && (errno == EINTR))
+                    continue;
+                /* short file, reply with zeroes rather than garbage */
+                memset(Gathered + Copied, 0, Length - Copied);
+                break;
+            }
+            Copied += Got;
+        }
+        *ToFree = Gathered;
+        return Gathered;
+    }
+    while ((i < TS->DataCount - 1) && (Offset >= TS->DataVec[i].DataSize))
+    {
+        Offset -= TS->DataVec[i].DataSize;
+        i++;
+    }
+    if (Offset + Length <= TS->DataVec[i].DataSize)
+    {
+        return TS->DataVec[i].block + Offset;
+    }
+    Gathered = malloc(Length);
+    while ((Copied < Length) && (i < TS->DataCount))
+    {
+        size_t Piece = TS->DataVec[i].DataSize - Offset;
+        if (Piece > Length - Copied)
+        {
+            Piece = Length - Copied;
+        }
+        memcpy(Gathered + Copied, TS->DataVec[i].block + Offset, Piece);
+        Copied += Piece;
+        Offset = 0;
+        i++;
+    }
+    *ToFree = Gathered;
+    return Gathered;
+}
+
 // writer side routine, called by the network handler thread
 static void EvpathReadRequestHandler(CManager cm, CMConnection incoming_conn,
                                      void *msg_v, void *client_Data,
@@ -406,12 +535,19 @@ static void EvpathReadRequestHandler(CManager cm, CMConnection incoming_conn,
         {
             struct _EvpathReadReplyMsg ReadReplyMsg;
             CMConnection ReplyConn;
+            char *ToFree;
+            /* memory replies keep the timestep from being spilled until sent
+             */
+            int InMemory = (tmp->SpillFD == -1);
             /* memset avoids uninit byte warnings from valgrind */
             MarkReadRequest(tmp, WSR_Stream, RequestingRank);
+            if (InMemory)
+            {
+                tmp->ReadsInFlight++;
+            }
             memset(&ReadReplyMsg, 0, sizeof(ReadReplyMsg));
             ReadReplyMsg.Timestep = ReadRequestMsg->Timestep;
             ReadReplyMsg.DataLength = ReadRequestMsg->Length;
-            ReadReplyMsg.Data = tmp->Data.block + ReadRequestMsg->Offset;
             ReadReplyMsg.RS_Stream = ReadRequestMsg->RS_Stream;
             ReadReplyMsg.NotifyCondition = ReadRequestMsg->NotifyCondition;
             Svcs->verbose(
@@ -439,7 +575,18 @@ static void EvpathReadRequestHandler(CManager cm, CMConnection incoming_conn,
             }
             CMFormat Format = WS_Stream->ReadReplyFormat;
             pthread_mutex_unlock(&WS_Stream->DataLock);
+            /* outside the lock, spilled data is read back from its file */
+            ReadReplyMsg.Data =
+                TimestepDataRange(tmp, ReadRequestMsg->Offset,
+                                  ReadRequestMsg->Length, &ToFree);
             CMwrite(ReplyConn, Format, &ReadReplyMsg);
+            free(ToFree);
+            if (InMemory)
+            {
+                pthread_mutex_lock(&WS_Stream->DataLock);
+                tmp->ReadsInFlight--;
+                pthread_mutex_unlock(&WS_Stream->DataLock);
+            }
 
             PERFSTUBS_TIMER_STOP_FUNC(timer);
             return;
@@ -632,6 +779,81 @@ static void DiscardPriorPreloaded(CP_Services Svcs, Evpath_RS_Stream RS_Stream,
     }
 }
 
+// reader-side routine, called from the main program
+static int HandleRequestWithShm(CP_Services Svcs, Evpath_RS_Stream RS_Stream,
+                                int Rank, long Timestep, size_t Offset,
+                                size_t Length, void *Buffer,
+                                EvpathPerTimestepInfo Info)
+{
+    RSShmSegmentList Segment = RS_Stream->ShmSegments;
+    while (Segment &&
+           ((Segment->WriterRank != Rank) || (Segment->Timestep != Timestep)))
+    {
+        Segment = Segment->Next;
+    }
+    if (!Segment)
+    {
+        if (!Info || (Info->ShmId == -1) || !Info->HostName ||
+            (strcmp(Info->HostName, RS_Stream->HostName) != 0))
+        {
+            return 0;
+        }
+        char *Addr = shmat(Info->ShmId, NULL, SHM_RDONLY);
+        if (Addr == (char *)-1)
+        {
+            Svcs->verbose(RS_Stream->CP_Stream, DPPerRankVerbose,
+                          "Failed to attach shared memory segment %d of "
+                          "writer rank %d, falling back to remote reads\n",
+                          Info->ShmId, Rank);
+            return 0;
+        }
+        Segment = calloc(1, sizeof(*Segment));
+        Segment->Timestep = Timestep;
+        Segment->WriterRank = Rank;
+        Segment->Addr = Addr;
+        Segment->Next = RS_Stream->ShmSegments;
+        RS_Stream->ShmSegments = Segment;
+    }
+    Svcs->verbose(RS_Stream->CP_Stream, DPTraceVerbose,
+                  "Satisfying remote memory read with shared memory from "
+                  "writer rank %d for timestep %ld\n",
+                  Rank, Timestep);
+    memcpy(Buffer, Segment->Addr + Offset, Length);
+    RS_Stream->Stats->DataBytesReceived += Length;
+    return 1;
+}
+
+// reader-side routine, called from the main program
+static void DetachShmSegments(CP_Services Svcs, Evpath_RS_Stream RS_Stream,
+                              long Timestep)
+{
+    RSShmSegmentList Segment, Last = NULL;
+    Segment = RS_Stream->ShmSegments;
+
+    while (Segment)
+    {
+        RSShmSegmentList Next = Segment->Next;
+        if (Segment->Timestep <= Timestep)
+        {
+            if (Last)
+            {
+                Last->Next = Next;
+            }
+            else
+            {
+                RS_Stream->ShmSegments = Next;
+            }
+            shmdt(Segment->Addr);
+            free(Segment);
+        }
+        else
+        {
+            Last = Segment;
+        }
+        Segment = Next;
+    }
+}
+
 static void RemoveRequestFromList(CP_Services Svcs, Evpath_RS_Stream Stream,
                                   EvpathCompletionHandle Handle);
 
@@ -710,6 +932,11 @@ static DP_WS_Stream EvpathInitWriter(CP_Services Svcs, void *CP_Stream,
      */
     Stream->CP_Stream = CP_Stream;
     Stream->Stats = Stats;
+    Stream->UseShm = UseShmDP(Params);
+    if (Stream->UseShm)
+    {
+        Stream->HostName = GetHostName();
+    }
 
     /*
      * add a handler for read request messages
@@ -760,6 +987,15 @@ static void EvpathDestroyWriter(CP_Services Svcs, DP_WS_Stream WS_Stream_v)
         }
     }
     free(WS_Stream->Readers);
+    while (WS_Stream->Timesteps)
+    {
+        /* shm segments outlive the process unless removed */
+        TimestepList Next = WS_Stream->Timesteps->Next;
+        FreeTimestepInfo(WS_Stream->Timesteps);
+        free(WS_Stream->Timesteps);
+        WS_Stream->Timesteps = Next;
+    }
+    free(WS_Stream->HostName);
     free(WS_Stream);
 }
 
@@ -972,12 +1208,6 @@ static void FailRequestsToRank(CP_Services Svcs, CManager cm,
                   FailedRank, Stream);
 }
 
-typedef struct _EvpathPerTimestepInfo
-{
-    char *CheckString;
-    int CheckInt;
-} * EvpathPerTimestepInfo;
-
 // reader-side routine, called from the main program
 static void *EvpathReadRemoteMemory(CP_Services Svcs, DP_RS_Stream Stream_v,
                                     int Rank, long Timestep, size_t Offset,
@@ -1001,8 +1231,17 @@ static void *EvpathReadRemoteMemory(CP_Services Svcs, DP_RS_Stream Stream_v,
         DiscardPriorPreloaded(Svcs, Stream, Timestep);
     }
     LastRequestedTimestep = Timestep;
-    HadPreload = HandleRequestWithPreloaded(Svcs, Stream, Rank, Timestep,
-                                            Offset, Length, Buffer);
+    if (Stream->UseShm)
+    {
+        HadPreload = HandleRequestWithShm(
+            Svcs, Stream, Rank, Timestep, Offset, Length, Buffer,
+            (EvpathPerTimestepInfo)DP_TimestepInfo);
+    }
+    else
+    {
+        HadPreload = HandleRequestWithPreloaded(Svcs, Stream, Rank, Timestep,
+                                                Offset, Length, Buffer);
+    }
     ret->CPStream = Stream->CP_Stream;
     ret->DPStream = Stream;
     ret->Failed = 0;
@@ -1153,6 +1392,12 @@ static void EvpathWSReaderRegisterTimestep(CP_Services Svcs,
         WSR_Stream->WS_Stream; /* pointer to writer struct */
     TimestepList Entry;
 
+    if (WS_Stream->UseShm)
+    {
+        // local readers use shared memory, remote ones send requests
+        PreloadMode = SstPreloadNone;
+    }
+
     pthread_mutex_lock(&WS_Stream->DataLock);
     if ((WSR_Stream->CurPreloadMode == SstPreloadSpeculative) &&
         (PreloadMode == SstPreloadLearned))
@@ -1224,6 +1469,11 @@ static void EvpathRSTimestepArrived(CP_Services Svcs, DP_RS_Stream RS_Stream_v,
         "EVPATH registering reader arrival of TS %ld metadata, preload mode "
         "%d\n",
         Timestep, PreloadMode);
+    if (RS_Stream->UseShm)
+    {
+        // the writer doesn't preload in shm mode
+        PreloadMode = SstPreloadNone;
+    }
     if (PreloadMode != RS_Stream->CurPreloadMode)
     {
         RS_Stream->PreloadActiveTimestep = Timestep;
@@ -1231,6 +1481,16 @@ static void EvpathRSTimestepArrived(CP_Services Svcs, DP_RS_Stream RS_Stream_v,
     }
 }
 
+// reader-side routine, called from the main program
+static void EvpathRSReleaseTimestep(CP_Services Svcs, DP_RS_Stream RS_Stream_v,
+                                    long Timestep)
+{
+    Evpath_RS_Stream RS_Stream = (Evpath_RS_Stream)RS_Stream_v;
+    pthread_mutex_lock(&RS_Stream->DataLock);
+    DetachShmSegments(Svcs, RS_Stream, Timestep);
+    pthread_mutex_unlock(&RS_Stream->DataLock);
+}
+
 // reader-side routine, called from either thread
 static void SendPreloadMsgs(CP_Services Svcs, Evpath_WSR_Stream WSR_Stream,
                             TimestepList TS)
@@ -1238,13 +1498,14 @@ static void SendPreloadMsgs(CP_Services Svcs, Evpath_WSR_Stream WSR_Stream,
     Evpath_WS_Stream WS_Stream =
         WSR_Stream->WS_Stream; /* pointer to writer struct */
     struct _EvpathPreloadMsg PreloadMsg;
+    char *ToFree;
     Svcs->verbose(WS_Stream->CP_Stream, DPPerRankVerbose,
                   "EVPATH Sending preload messages for timestep %ld\n",
                   TS->Timestep);
     memset(&PreloadMsg, 0, sizeof(PreloadMsg));
     PreloadMsg.Timestep = TS->Timestep;
     PreloadMsg.DataLength = TS->Data.DataSize;
-    PreloadMsg.Data = TS->Data.block;
+    PreloadMsg.Data = TimestepDataRange(TS, 0, TS->Data.DataSize, &ToFree);
     PreloadMsg.WriterRank = WS_Stream->Rank;
 
     for (int i = 0; i < WSR_Stream->ReaderCohortSize; i++)
@@ -1260,6 +1521,7 @@ static void SendPreloadMsgs(CP_Services Svcs, Evpath_WSR_Stream WSR_Stream,
                     WS_Stream->PreloadFormat, &PreloadMsg);
         }
     }
+    free(ToFree);
 }
 
 static void SendSpeculativePreloadMsgs(CP_Services Svcs,
@@ -1270,10 +1532,11 @@ static void SendSpeculativePreloadMsgs(CP_Services Svcs,
         WSR_Stream->WS_Stream; /* pointer to writer struct */
     CManager cm = Svcs->getCManager(WS_Stream->CP_Stream);
     struct _EvpathPreloadMsg PreloadMsg;
+    char *ToFree;
     memset(&PreloadMsg, 0, sizeof(PreloadMsg));
     PreloadMsg.Timestep = TS->Timestep;
     PreloadMsg.DataLength = TS->Data.DataSize;
-    PreloadMsg.Data = TS->Data.block;
+    PreloadMsg.Data = TimestepDataRange(TS, 0, TS->Data.DataSize, &ToFree);
     PreloadMsg.WriterRank = WS_Stream->Rank;
 
     for (int i = 0; i < WSR_Stream->ReaderCohortSize; i++)
@@ -1291,6 +1554,7 @@ static void SendSpeculativePreloadMsgs(CP_Services Svcs,
                     "Failed to connect to reader rank %d for response to "
                     "remote read, assume failure, no response sent\n",
                     i);
+                free(ToFree);
                 return;
             }
             WSR_Stream->ReaderContactInfo[i].Conn = Conn;
@@ -1299,6 +1563,7 @@ static void SendSpeculativePreloadMsgs(CP_Services Svcs,
         CMwrite(WSR_Stream->ReaderContactInfo[i].Conn, WS_Stream->PreloadFormat,
                 &PreloadMsg);
     }
+    free(ToFree);
 }
 
 static void EvpathReaderReleaseTimestep(CP_Services Svcs,
@@ -1354,10 +1619,10 @@ static void EvpathReaderReleaseTimestep(CP_Services Svcs,
     pthread_mutex_unlock(&WS_Stream->DataLock);
 }
 
-static void EvpathProvideTimestep(CP_Services Svcs, DP_WS_Stream Stream_v,
-                                  struct _SstData *Data,
-                                  struct _SstData *LocalMetadata, long Timestep,
-                                  void **TimestepInfoPtr)
+static void EvpathProvideTimestepV(CP_Services Svcs, DP_WS_Stream Stream_v,
+                                   struct _SstData *Data, int DataCount,
+                                   struct _SstData *LocalMetadata,
+                                   long Timestep, void **TimestepInfoPtr)
 {
     Evpath_WS_Stream WS_Stream = (Evpath_WS_Stream)Stream_v;
     TimestepList Entry = malloc(sizeof(struct _TimestepEntry));
@@ -1374,15 +1639,68 @@ static void EvpathProvideTimestep(CP_Services Svcs, DP_WS_Stream Stream_v,
     //    *TimestepInfoPtr = Info;
     memset(Entry, 0, sizeof(*Entry));
     Entry->DP_TimestepInfo = NULL;
-    Entry->Data = *Data;
+    Entry->SpillFD = -1;
+    /* the blocks themselves are served in place, without copying */
+    Entry->DataVec = malloc(DataCount * sizeof(Entry->DataVec[0]));
+    memcpy(Entry->DataVec, Data, DataCount * sizeof(Entry->DataVec[0]));
+    Entry->DataCount = DataCount;
+    for (int i = 0; i < DataCount; i++)
+    {
+        Entry->Data.DataSize += Data[i].DataSize;
+    }
+    Entry->Data.block = (DataCount == 1) ? Data->block : NULL;
     Entry->Timestep = Timestep;
     Entry->Next = NULL;
+    *TimestepInfoPtr = NULL;
 
-    Svcs->verbose(
-        WS_Stream->CP_Stream, DPPerRankVerbose,
-        "ProvideTimestep, registering timestep %ld, data %p, fprint %lx\n",
-        Timestep, Data->block,
-        writeBlockFingerprint(Data->block, Data->DataSize));
+    if (WS_Stream->UseShm)
+    {
+        /* an invalid ShmId tells local readers to send requests too */
+        EvpathPerTimestepInfo Info = malloc(sizeof(*Info));
+        Info->HostName = strdup(WS_Stream->HostName);
+        Info->ShmId = -1;
+        if (Entry->Data.DataSize > 0)
+        {
+            Info->ShmId =
+                shmget(IPC_PRIVATE, Entry->Data.DataSize, IPC_CREAT | 0600);
+        }
+        if (Info->ShmId != -1)
+        {
+            Entry->ShmAddr = shmat(Info->ShmId, NULL, 0);
+            if (Entry->ShmAddr == (char *)-1)
+            {
+                shmctl(Info->ShmId, IPC_RMID, NULL);
+                Info->ShmId = -1;
+                Entry->ShmAddr = NULL;
+            }
+            else
+            {
+                size_t Offset = 0;
+                for (int i = 0; i < DataCount; i++)
+                {
+                    memcpy(Entry->ShmAddr + Offset, Data[i].block,
+                           Data[i].DataSize);
+                    Offset += Data[i].DataSize;
+                }
+            }
+        }
+        if ((Info->ShmId == -1) && (Entry->Data.DataSize > 0))
+        {
+            Svcs->verbose(WS_Stream->CP_Stream, DPPerRankVerbose,
+                          "Failed to create a shared memory segment of %zu "
+                          "bytes for timestep %ld\n",
+                          Entry->Data.DataSize, Timestep);
+        }
+        Entry->DP_TimestepInfo = Info;
+        *TimestepInfoPtr = Info;
+    }
+
+    Svcs->verbose(WS_Stream->CP_Stream, DPPerRankVerbose,
+                  "ProvideTimestep, registering timestep %ld, data %p in %d "
+                  "block(s), fprint %lx\n",
+                  Timestep, Data->block, DataCount,
+                  writeBlockFingerprint(Entry->Data.block,
+                                        Entry->Data.DataSize));
     pthread_mutex_lock(&WS_Stream->DataLock);
     if (WS_Stream->Timesteps)
     {
@@ -1398,7 +1716,126 @@ static void EvpathProvideTimestep(CP_Services Svcs, DP_WS_Stream Stream_v,
         WS_Stream->Timesteps = Entry;
     }
     pthread_mutex_unlock(&WS_Stream->DataLock);
-    *TimestepInfoPtr = NULL;
+}
+
+static void EvpathProvideTimestep(CP_Services Svcs, DP_WS_Stream Stream_v,
+                                  struct _SstData *Data,
+                                  struct _SstData *LocalMetadata, long Timestep,
+                                  void **TimestepInfoPtr)
+{
+    EvpathProvideTimestepV(Svcs, Stream_v, Data, 1, LocalMetadata, Timestep,
+                           TimestepInfoPtr);
+}
+
+/*
+ * Writes the timestep's blocks one after the other to an unlinked file in
+ * Directory, which goes away with its descriptor, then serves further reads
+ * from that file and drops the blocks.  Replies already being sent from the
+ * blocks are waited for.  The shm copy, if any, stays for local readers.
+ */
+static int EvpathSpillTimestep(CP_Services Svcs, DP_WS_Stream Stream_v,
+                               long Timestep, const char *Directory)
+{
+    Evpath_WS_Stream WS_Stream = (Evpath_WS_Stream)Stream_v;
+    size_t PathLen = strlen(Directory) + sizeof("/SstSpill.XXXXXX");
+    char *Path = malloc(PathLen);
+    TimestepList Entry;
+    struct _SstData *DataVec;
+    int DataCount;
+    int FD;
+
+    pthread_mutex_lock(&WS_Stream->DataLock);
+    Entry = WS_Stream->Timesteps;
+    while (Entry && (Entry->Timestep != Timestep))
+    {
+        Entry = Entry->Next;
+    }
+    pthread_mutex_unlock(&WS_Stream->DataLock);
+    if (!Entry || (Entry->SpillFD != -1))
+    {
+        free(Path);
+        return 0;
+    }
+    /* the control plane holds the timestep, so it isn't released meanwhile */
+    DataVec = Entry->DataVec;
+    DataCount = Entry->DataCount;
+
+    snprintf(Path, PathLen, "%s/SstSpill.XXXXXX", Directory);
+    FD = mkstemp(Path);
+    if (FD == -1)
+    {
+        Svcs->verbose(WS_Stream->CP_Stream, DPCriticalVerbose,
+                      "Failed to create spill file %s for timestep %ld, "
+                      "keeping it in memory\n",
+                      Path, Timestep);
+        free(Path);
+        return 0;
+    }
+    unlink(Path);
+    for (int i = 0; i < DataCount; i++)
+    {
+        size_t Written = 0;
+        while (Written < DataVec[i].DataSize)
+        {
+            ssize_t Ret = write(FD, DataVec[i].block + Written,
+                                DataVec[i].DataSize - Written);
+            if (Ret == -1)
+            {
+                if (errno == EINTR)
+                    continue;
+                Svcs->verbose(WS_Stream->CP_Stream, DPCriticalVerbose,
+                              "Failed to write spill file %s for timestep "
+                              "%ld, keeping it in memory: %s\n",
+                              Path, Timestep, strerror(errno));
+                close(FD);
+                free(Path);
+                return 0;
+            }
+            Written += Ret;
+        }
+    }
+
+    pthread_mutex_lock(&WS_Stream->DataLock);
+    Entry->SpillFD = FD;
+    while (Entry->ReadsInFlight)
+    {
+        pthread_mutex_unlock(&WS_Stream->DataLock);
+        usleep(1000);
+        pthread_mutex_lock(&WS_Stream->DataLock);
+    }
+    Entry->DataVec = NULL;
+    Entry->Data.block = NULL;
+    pthread_mutex_unlock(&WS_Stream->DataLock);
+    free(DataVec);
+
+    Svcs->verbose(WS_Stream->CP_Stream, DPPerRankVerbose,
+                  "Spilled timestep %ld, %zu bytes, to %s\n", Timestep,
+                  Entry->Data.DataSize, Path);
+    free(Path);
+    return 1;
+}
+
+/*
+ * Frees the block list, the per-timestep info and the shm segment, readers
+ * that still have it attached keep it until they detach
+ */
+static void FreeTimestepInfo(TimestepList Entry)
+{
+    free(Entry->DataVec);
+    if (Entry->SpillFD != -1)
+    {
+        close(Entry->SpillFD);
+    }
+    if (Entry->ShmAddr)
+    {
+        shmdt(Entry->ShmAddr);
+        shmctl(Entry->DP_TimestepInfo->ShmId, IPC_RMID, NULL);
+    }
+    if (Entry->DP_TimestepInfo)
+    {
+        free(Entry->DP_TimestepInfo->HostName);
+        free(Entry->DP_TimestepInfo);
+    }
 }
 
 static void EvpathReleaseTimestep(CP_Services Svcs, DP_WS_Stream Stream_v,
@@ -1414,10 +1851,7 @@ static void EvpathReleaseTimestep(CP_Services Svcs, DP_WS_Stream Stream_v,
     if (WS_Stream->Timesteps && (WS_Stream->Timesteps->Timestep == Timestep))
     {
         WS_Stream->Timesteps = List->Next;
-        if (List->DP_TimestepInfo && List->DP_TimestepInfo->CheckString)
-            free(List->DP_TimestepInfo->CheckString);
-        if (List->DP_TimestepInfo)
-            free(List->DP_TimestepInfo);
+        FreeTimestepInfo(List);
         if (List->ReaderRequests)
         {
             ReaderRequestTrackPtr tmp = List->ReaderRequests;
@@ -1442,10 +1876,7 @@ static void EvpathReleaseTimestep(CP_Services Svcs, DP_WS_Stream Stream_v,
             if (List->Timestep == Timestep)
             {
                 last->Next = List->Next;
-                if (List->DP_TimestepInfo && List->DP_TimestepInfo->CheckString)
-                    free(List->DP_TimestepInfo->CheckString);
-                if (List->DP_TimestepInfo)
-                    free(List->DP_TimestepInfo);
+                FreeTimestepInfo(List);
                 if (List->ReaderRequests)
                 {
                     ReaderRequestTrackPtr tmp = List->ReaderRequests;
@@ -1501,17 +1932,16 @@ static FMStructDescRec EvpathWriterContactStructs[] = {
      sizeof(struct _EvpathWriterContactInfo), NULL},
     {NULL, NULL, 0, NULL}};
 
-// static FMField EvpathTimestepInfoList[] = {
-//    {"CheckString", "string", sizeof(char *),
-//     FMOffset(EvpathPerTimestepInfo, CheckString)},
-//    {"CheckInt", "integer", sizeof(void *),
-//     FMOffset(EvpathPerTimestepInfo, CheckInt)},
-//    {NULL, NULL, 0, 0}};
+static FMField EvpathTimestepInfoList[] = {
+    {"HostName", "string", sizeof(char *),
+     FMOffset(EvpathPerTimestepInfo, HostName)},
+    {"ShmId", "integer", sizeof(int), FMOffset(EvpathPerTimestepInfo, ShmId)},
+    {NULL, NULL, 0, 0}};
 
-// static FMStructDescRec EvpathTimestepInfoStructs[] = {
-//    {"EvpathTimestepInfo", EvpathTimestepInfoList,
-//     sizeof(struct _EvpathPerTimestepInfo), NULL},
-//    {NULL, NULL, 0, NULL}};
+static FMStructDescRec EvpathTimestepInfoStructs[] = {
+    {"EvpathTimestepInfo", EvpathTimestepInfoList,
+     sizeof(struct _EvpathPerTimestepInfo), NULL},
+    {NULL, NULL, 0, NULL}};
 
 static struct _CP_DP_Interface evpathDPInterface = {
     NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
@@ -1531,7 +1961,7 @@ extern NO_SANITIZE_THREAD CP_DP_Interface LoadEVpathDP()
 {
     evpathDPInterface.ReaderContactFormats = EvpathReaderContactStructs;
     evpathDPInterface.WriterContactFormats = EvpathWriterContactStructs;
-    evpathDPInterface.TimestepInfoFormats = NULL; // EvpathTimestepInfoStructs;
+    evpathDPInterface.TimestepInfoFormats = NULL; // shm only
     evpathDPInterface.initReader = EvpathInitReader;
     evpathDPInterface.initWriter = EvpathInitWriter;
     evpathDPInterface.initWriterPerReader = EvpathInitWriterPerReader;
@@ -1541,7 +1971,9 @@ extern NO_SANITIZE_THREAD CP_DP_Interface LoadEVpathDP()
     evpathDPInterface.waitForCompletion = EvpathWaitForCompletion;
     evpathDPInterface.notifyConnFailure = EvpathNotifyConnFailure;
     evpathDPInterface.provideTimestep = EvpathProvideTimestep;
+    evpathDPInterface.provideTimestepV = EvpathProvideTimestepV;
     evpathDPInterface.releaseTimestep = EvpathReleaseTimestep;
+    evpathDPInterface.spillTimestep = EvpathSpillTimestep;
     evpathDPInterface.readerRegisterTimestep = EvpathWSReaderRegisterTimestep;
     evpathDPInterface.readerReleaseTimestep = EvpathReaderReleaseTimestep;
     evpathDPInterface.WSRreadPatternLocked = NULL;
@@ -1554,3 +1986,21 @@ extern NO_SANITIZE_THREAD CP_DP_Interface LoadEVpathDP()
     evpathDPInterface.unGetPriority = NULL;
     return &evpathDPInterface;
 }
+
+static struct _CP_DP_Interface shmDPInterface;
+
+static int ShmGetPriority(CP_Services Svcs, void *CP_Stream,
+                          struct _SstParams *Params)
+{
+    /* only used if asked for, it costs a copy per timestep on the writer */
+    return 0;
+}
+
+extern NO_SANITIZE_THREAD CP_DP_Interface LoadShmDP()
+{
+    shmDPInterface = *LoadEVpathDP();
+    shmDPInterface.TimestepInfoFormats = EvpathTimestepInfoStructs;
+    shmDPInterface.RSReleaseTimestep = EvpathRSReleaseTimestep;
+    shmDPInterface.getPriority = ShmGetPriority;
+    return &shmDPInterface;
+}
@@ -226,6 +226,29 @@ typedef void (*CP_DP_ProvideTimestepFunc)(CP_Services Svcs, DP_WS_Stream Stream,
                                           long Timestep,
                                           void **TimestepInfoPtr);
 
+/*!
+ * CP_DP_ProvideTimestepVFunc is the type of an optional dataplane function
+ * that does what CP_DP_ProvideTimestepFunc does, but takes the data of the
+ * timestep as `DataCount` blocks that follow each other.  Offsets in read
+ * requests are into their concatenation, and the blocks stay valid until the
+ * timestep is released.  If a dataplane doesn't provide it, the control
+ * plane gathers the blocks into one and calls provideTimestep instead.
+ */
+typedef void (*CP_DP_ProvideTimestepVFunc)(
+    CP_Services Svcs, DP_WS_Stream Stream, struct _SstData *Data,
+    int DataCount, struct _SstData *LocalMetadata, long Timestep,
+    void **TimestepInfoPtr);
+
+/*!
+ * CP_DP_SpillTimestepFunc is the type of an optional writer-side dataplane
+ * function that moves the data of an unreleased timestep out of memory into
+ * a file in `Directory`, to be read back from there when readers ask for it.
+ * It returns 1 if the data given to provideTimestep is no longer referenced
+ * and may be freed by the control plane, 0 if it was left in memory.
+ */
+typedef int (*CP_DP_SpillTimestepFunc)(CP_Services Svcs, DP_WS_Stream Stream,
+                                       long Timestep, const char *Directory);
+
 typedef enum
 {
     SstPreloadNone,
@@ -356,6 +379,8 @@ struct _CP_DP_Interface
 
     CP_DP_ProvideTimestepFunc provideTimestep; // writer-side call, one per
                                                // timestep upon provision to DP
+    CP_DP_ProvideTimestepVFunc provideTimestepV; // optional, the same for
+                                                 // data in several blocks
     CP_DP_PerReaderTimestepRegFunc
         readerRegisterTimestep; // writer-side call, one per reader, upon
                                 // metadata send
@@ -365,6 +390,8 @@ struct _CP_DP_Interface
     CP_DP_ReleaseTimestepFunc
         releaseTimestep; // writer-side call, one per timestep when all readers
                          // are done
+    CP_DP_SpillTimestepFunc spillTimestep; // optional writer-side call, for
+                                           // QueueFullPolicy Spill
     CP_DP_PerReaderReleaseTimestepFunc
         readerReleaseTimestep; // writer-side call, one per reader when that
                                // reader is done
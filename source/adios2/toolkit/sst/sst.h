@@ -67,7 +67,8 @@ typedef enum
 typedef enum
 {
     SstQueueFullBlock = 0,
-    SstQueueFullDiscard = 1
+    SstQueueFullDiscard = 1,
+    SstQueueFullSpill = 2
 } SstQueueFullPolicy;
 
 typedef enum
@@ -96,6 +97,13 @@ SstProvideTimestepMM(SstStream s, SstData LocalMetadata, SstData LocalData,
                      long Timestep, DataFreeFunc FreeData, void *FreeClientData,
                      SstData AttributeData, DataFreeFunc FreeAttribute,
                      void *FreeAttributeClientData, SstMetaMetaList MMBlocks);
+/*  SstProvideTimestepMMV takes the data as DataCount blocks, which are
+ * not copied and must stay valid until FreeData is called */
+extern void SstProvideTimestepMMV(
+    SstStream s, SstData LocalMetadata, SstData LocalData, int DataCount,
+    long Timestep, DataFreeFunc FreeData, void *FreeClientData,
+    SstData AttributeData, DataFreeFunc FreeAttribute,
+    void *FreeAttributeClientData, SstMetaMetaList MMBlocks);
 extern void SstWriterClose(SstStream stream);
 /*  SstWriterDefinitionLock is called once only, on transition from unlock to
  * locked definitions */
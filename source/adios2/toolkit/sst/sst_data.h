@@ -42,6 +42,7 @@ typedef struct _SstStats
     size_t BytesTransferred;
     size_t TimestepsCreated;
     size_t TimestepsDelivered;
+    size_t TimestepsSpilled;
 
     size_t TimestepMetadataReceived;
     size_t TimestepsConsumed;
@@ -64,6 +65,7 @@ typedef struct _SstStats
     MACRO(QueueLimit, Int, int, 0)                                             \
     MACRO(ReserveQueueLimit, Int, int, 0)                                      \
     MACRO(QueueFullPolicy, QueueFullPolicy, size_t, 0)                         \
+    MACRO(SpillDirectory, String, char *, NULL)                                \
     MACRO(IsRowMajor, IsRowMajor, int, 0)                                      \
     MACRO(FirstTimestepPrecious, Bool, int, 0)                                 \
     MACRO(ControlTransport, String, char *, NULL)                              \
@@ -76,6 +78,8 @@ typedef struct _SstStats
     MACRO(SpeculativePreloadMode, SpecPreloadMode, int, SpecPreloadAuto)       \
     MACRO(SpecAutoNodeThreshold, Int, int, 1)                                  \
     MACRO(ReaderShortCircuitReads, Bool, int, 0)                               \
+    MACRO(PrefetchDepth, Int, int, 0)                                          \
+    MACRO(ZeroCopyDeferredPuts, Bool, int, 0)                                  \
     MACRO(ControlModule, String, char *, NULL)
 
 typedef enum
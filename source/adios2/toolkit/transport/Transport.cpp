@@ -27,11 +27,27 @@ void Transport::IWrite(const char *buffer, size_t size, Status &status,
     throw std::invalid_argument("ERROR: this class doesn't implement IWrite\n");
 }
 
+void Transport::WriteV(const core::iovec *iov, const int iovcnt, size_t start)
+{
+    for (int i = 0; i < iovcnt; ++i)
+    {
+        Write(static_cast<const char *>(iov[i].iov_base), iov[i].iov_len,
+              i == 0 ? start : MaxSizeT);
+    }
+}
+
 void Transport::IRead(char *buffer, size_t size, Status &status, size_t start)
 {
     throw std::invalid_argument("ERROR: this class doesn't implement IRead\n");
 }
 
+const char *Transport::ReadInPlace(size_t /*size*/, size_t /*start*/)
+{
+    return nullptr;
+}
+
+bool Transport::IsThreadSafe() const noexcept { return false; }
+
 void Transport::InitProfiler(const Mode openMode, const TimeUnit timeUnit)
 {
     m_Profiler.m_IsActive = true;
@@ -94,6 +110,7 @@ void Transport::ProfilerStart(const std::string process) noexcept
 {
     if (m_Profiler.m_IsActive)
     {
+        std::lock_guard<std::mutex> lock(m_ProfilerMutex);
         m_Profiler.m_Timers.at(process).Resume();
     }
 }
@@ -102,6 +119,7 @@ void Transport::ProfilerStop(const std::string process) noexcept
 {
     if (m_Profiler.m_IsActive)
     {
+        std::lock_guard<std::mutex> lock(m_ProfilerMutex);
         m_Profiler.m_Timers.at(process).Pause();
     }
 }
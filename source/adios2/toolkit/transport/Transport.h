@@ -12,12 +12,14 @@
 #define ADIOS2_TOOLKIT_TRANSPORT_TRANSPORT_H_
 
 /// \cond EXCLUDE_FROM_DOXYGEN
+#include <mutex>
 #include <string>
 #include <vector>
 /// \endcond
 
 #include "adios2/common/ADIOSConfig.h"
 #include "adios2/common/ADIOSTypes.h"
+#include "adios2/core/CoreTypes.h"
 #include "adios2/helper/adiosComm.h"
 #include "adios2/toolkit/profiling/iochrono/IOChrono.h"
 
@@ -93,6 +95,18 @@ public:
     virtual void IWrite(const char *buffer, size_t size, Status &status,
                         size_t start = MaxSizeT);
 
+    /**
+     * Writes a list of memory regions back to back (gather write). The
+     * default implementation calls Write once per region, transports with a
+     * native vectored call override it.
+     * @param iov memory regions to be written, in order
+     * @param iovcnt number of regions in iov
+     * @param start starting position for writing the first region, if not
+     * passed then start at current stream position
+     */
+    virtual void WriteV(const core::iovec *iov, const int iovcnt,
+                        size_t start = MaxSizeT);
+
     /**
      * Reads from transport "size" bytes from a certain position. Note that size
      * and position and non-const due to the nature of underlying transport
@@ -108,6 +122,25 @@ public:
     virtual void IRead(char *buffer, size_t size, Status &status,
                        size_t start = MaxSizeT);
 
+    /**
+     * Gives access to size bytes of the file from start without copying them
+     * into a buffer, for transports that keep the file mapped in memory
+     * @param size number of bytes needed
+     * @param start starting position in the file
+     * @return address of the bytes, valid until Close, or nullptr if the
+     * transport can't do this and Read must be used instead
+     */
+    virtual const char *ReadInPlace(size_t size, size_t start);
+
+    /**
+     * Tells if Read, Write and WriteV calls with an explicit start position
+     * may run concurrently from several threads on this transport. Such
+     * calls then never use nor move the current stream position.
+     * @return true: positional I/O is thread-safe, false (default): calls
+     * must be serialized by the caller
+     */
+    virtual bool IsThreadSafe() const noexcept;
+
     /**
      * Returns the size of current data in transport
      * @return size as size_t
@@ -128,6 +161,9 @@ public:
     virtual void SeekToBegin() = 0;
 
 protected:
+    /** keeps profiler timers consistent under concurrent positional I/O */
+    std::mutex m_ProfilerMutex;
+
     virtual void MkDir(const std::string &fileName);
 
     void ProfilerStart(const std::string process) noexcept;
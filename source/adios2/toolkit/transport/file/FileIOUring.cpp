@@ -0,0 +1,608 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileIOUring.cpp file I/O through a Linux io_uring, using the kernel
+ * interface directly
+ *
+ */
+#include "FileIOUring.h"
+#include "adios2/helper/adiosFunctions.h"
+
+#include <algorithm>      // std::min, std::remove_if
+#include <cstdio>         // remove
+#include <cstring>        // strerror, memset
+#include <errno.h>        // errno
+#include <fcntl.h>        // open
+#include <linux/io_uring.h>
+#include <sys/mman.h>     // mmap
+#include <sys/stat.h>     // open, fstat
+#include <sys/syscall.h>  // SYS_io_uring_*
+#include <sys/types.h>    // open
+#include <unistd.h>       // syscall, close, lseek
+
+/// \cond EXCLUDE_FROM_DOXYGEN
+#include <ios> //std::ios_base::failure
+/// \endcond
+
+namespace adios2
+{
+namespace transport
+{
+
+FileIOUring::FileIOUring(helper::Comm const &comm)
+: Transport("File", "IOUring", comm)
+{
+}
+
+FileIOUring::~FileIOUring()
+{
+    if (m_IsOpen)
+    {
+        try
+        {
+            WaitAll();
+        }
+        catch (...)
+        {
+        }
+        close(m_FileDescriptor);
+    }
+    DestroyRing();
+}
+
+void FileIOUring::Open(const std::string &name, const Mode openMode,
+                       const bool /*async*/)
+{
+    m_Name = name;
+    CheckName();
+    m_OpenMode = openMode;
+    m_Offset = 0;
+    switch (m_OpenMode)
+    {
+
+    case (Mode::Write):
+        ProfilerStart("open");
+        errno = 0;
+        m_FileDescriptor =
+            open(m_Name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+        m_Errno = errno;
+        ProfilerStop("open");
+        break;
+
+    case (Mode::Append):
+        ProfilerStart("open");
+        errno = 0;
+        m_FileDescriptor = open(m_Name.c_str(), O_RDWR | O_CREAT, 0777);
+        m_Errno = errno;
+        if (m_FileDescriptor != -1)
+        {
+            m_Offset =
+                static_cast<size_t>(lseek(m_FileDescriptor, 0, SEEK_END));
+        }
+        ProfilerStop("open");
+        break;
+
+    case (Mode::Read):
+        ProfilerStart("open");
+        errno = 0;
+        m_FileDescriptor = open(m_Name.c_str(), O_RDONLY);
+        m_Errno = errno;
+        ProfilerStop("open");
+        break;
+
+    default:
+        CheckFile("unknown open mode for file " + m_Name +
+                  ", in call to IOUring open");
+    }
+
+    CheckFile("couldn't open file " + m_Name + ", in call to IOUring open");
+    if (m_RingFD == -1)
+    {
+        SetupRing();
+    }
+    m_IsOpen = true;
+}
+
+void FileIOUring::SetParameters(const Params &parameters)
+{
+    for (const auto &pair : parameters)
+    {
+        const std::string key = helper::LowerCase(pair.first);
+        const std::string value = helper::LowerCase(pair.second);
+
+        if (key == "queuedepth")
+        {
+            m_QueueDepth = helper::StringTo<uint32_t>(
+                value, " in Parameter key=QueueDepth");
+            if (m_QueueDepth == 0)
+            {
+                throw std::invalid_argument(
+                    "ERROR: QueueDepth must be at least 1, in call to "
+                    "IOUring SetParameters\n");
+            }
+        }
+        else if (key == "chunksize")
+        {
+            m_ChunkSize = std::min(
+                helper::StringToByteUnits(value, " in Parameter key=ChunkSize"),
+                DefaultMaxFileBatchSize);
+            if (m_ChunkSize == 0)
+            {
+                throw std::invalid_argument(
+                    "ERROR: ChunkSize must be at least 1 byte, in call to "
+                    "IOUring SetParameters\n");
+            }
+        }
+    }
+}
+
+void FileIOUring::Write(const char *buffer, size_t size, size_t start)
+{
+    if (start != MaxSizeT)
+    {
+        m_Offset = start;
+    }
+
+    Operation op = {nullptr, 0, 0};
+    ProfilerStart("write");
+    Queue(op, const_cast<char *>(buffer), size, m_Offset, true);
+    m_Offset += size;
+    Wait(op);
+    ProfilerStop("write");
+
+    if (op.Error)
+    {
+        m_Errno = op.Error;
+        throw std::ios_base::failure("ERROR: couldn't write to file " + m_Name +
+                                     ", in call to IOUring Write" +
+                                     SysErrMsg());
+    }
+}
+
+void FileIOUring::IWrite(const char *buffer, size_t size, Status &status,
+                         size_t start)
+{
+    if (start != MaxSizeT)
+    {
+        m_Offset = start;
+    }
+
+    status.Bytes = 0;
+    status.Running = true;
+    status.Successful = false;
+    std::unique_ptr<Operation> op(new Operation{&status, 0, 0});
+    ProfilerStart("write");
+    Queue(*op, const_cast<char *>(buffer), size, m_Offset, true);
+    Submit();
+    ProfilerStop("write");
+    m_Offset += size;
+    if (op->Pending == 0)
+    {
+        status.Running = false;
+        status.Successful = (op->Error == 0);
+        return;
+    }
+
+    // forget about completed ones
+    m_AsyncOperations.erase(
+        std::remove_if(m_AsyncOperations.begin(), m_AsyncOperations.end(),
+                       [](const std::unique_ptr<Operation> &o) {
+                           return o->Pending == 0;
+                       }),
+        m_AsyncOperations.end());
+    m_AsyncOperations.push_back(std::move(op));
+}
+
+void FileIOUring::WriteV(const core::iovec *iov, const int iovcnt,
+                         size_t start)
+{
+    if (start != MaxSizeT)
+    {
+        m_Offset = start;
+    }
+
+    Operation op = {nullptr, 0, 0};
+    ProfilerStart("write");
+    for (int i = 0; i < iovcnt; ++i)
+    {
+        Queue(op,
+              const_cast<char *>(static_cast<const char *>(iov[i].iov_base)),
+              iov[i].iov_len, m_Offset, true);
+        m_Offset += iov[i].iov_len;
+    }
+    Wait(op);
+    ProfilerStop("write");
+
+    if (op.Error)
+    {
+        m_Errno = op.Error;
+        throw std::ios_base::failure("ERROR: couldn't write to file " + m_Name +
+                                     ", in call to IOUring WriteV" +
+                                     SysErrMsg());
+    }
+}
+
+void FileIOUring::Read(char *buffer, size_t size, size_t start)
+{
+    if (start != MaxSizeT)
+    {
+        m_Offset = start;
+    }
+
+    Operation op = {nullptr, 0, 0};
+    ProfilerStart("read");
+    Queue(op, buffer, size, m_Offset, false);
+    m_Offset += size;
+    Wait(op);
+    ProfilerStop("read");
+
+    if (op.Error)
+    {
+        m_Errno = op.Error;
+        throw std::ios_base::failure("ERROR: couldn't read from file " +
+                                     m_Name + ", in call to IOUring Read" +
+                                     SysErrMsg());
+    }
+}
+
+void FileIOUring::IRead(char *buffer, size_t size, Status &status,
+                        size_t start)
+{
+    if (start != MaxSizeT)
+    {
+        m_Offset = start;
+    }
+
+    status.Bytes = 0;
+    status.Running = true;
+    status.Successful = false;
+    std::unique_ptr<Operation> op(new Operation{&status, 0, 0});
+    ProfilerStart("read");
+    Queue(*op, buffer, size, m_Offset, false);
+    Submit();
+    ProfilerStop("read");
+    m_Offset += size;
+    if (op->Pending == 0)
+    {
+        status.Running = false;
+        status.Successful = (op->Error == 0);
+        return;
+    }
+
+    m_AsyncOperations.erase(
+        std::remove_if(m_AsyncOperations.begin(), m_AsyncOperations.end(),
+                       [](const std::unique_ptr<Operation> &o) {
+                           return o->Pending == 0;
+                       }),
+        m_AsyncOperations.end());
+    m_AsyncOperations.push_back(std::move(op));
+}
+
+size_t FileIOUring::GetSize()
+{
+    struct stat fileStat;
+    errno = 0;
+    if (fstat(m_FileDescriptor, &fileStat) == -1)
+    {
+        m_Errno = errno;
+        throw std::ios_base::failure("ERROR: couldn't get size of file " +
+                                     m_Name + SysErrMsg());
+    }
+    m_Errno = errno;
+    return static_cast<size_t>(fileStat.st_size);
+}
+
+void FileIOUring::Flush()
+{
+    ProfilerStart("write");
+    WaitAll();
+    ProfilerStop("write");
+}
+
+void FileIOUring::Close()
+{
+    WaitAll();
+    ProfilerStart("close");
+    errno = 0;
+    const int status = close(m_FileDescriptor);
+    m_Errno = errno;
+    ProfilerStop("close");
+
+    if (status == -1)
+    {
+        throw std::ios_base::failure("ERROR: couldn't close file " + m_Name +
+                                     ", in call to IOUring close" +
+                                     SysErrMsg());
+    }
+
+    m_IsOpen = false;
+}
+
+void FileIOUring::Delete()
+{
+    if (m_IsOpen)
+    {
+        Close();
+    }
+    std::remove(m_Name.c_str());
+}
+
+void FileIOUring::SeekToEnd() { m_Offset = GetSize(); }
+
+void FileIOUring::SeekToBegin() { m_Offset = 0; }
+
+// PRIVATE
+void FileIOUring::SetupRing()
+{
+    struct io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+
+    errno = 0;
+    m_RingFD = static_cast<int>(
+        syscall(__NR_io_uring_setup, m_QueueDepth, &params));
+    m_Errno = errno;
+    if (m_RingFD == -1)
+    {
+        throw std::ios_base::failure(
+            "ERROR: couldn't set up an io_uring of " +
+            std::to_string(m_QueueDepth) + " entries for file " + m_Name +
+            ", in call to IOUring open" + SysErrMsg());
+    }
+
+    m_SQRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    m_CQRingSize =
+        params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (singleMap)
+    {
+        m_SQRingSize = m_CQRingSize = std::max(m_SQRingSize, m_CQRingSize);
+    }
+
+    auto lf_Map = [&](size_t size, off_t offset) -> void * {
+        void *addr = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_POPULATE, m_RingFD, offset);
+        if (addr == MAP_FAILED)
+        {
+            m_Errno = errno;
+            DestroyRing();
+            throw std::ios_base::failure(
+                "ERROR: couldn't map the io_uring for file " + m_Name +
+                ", in call to IOUring open" + SysErrMsg());
+        }
+        return addr;
+    };
+
+    m_SQRing = lf_Map(m_SQRingSize, IORING_OFF_SQ_RING);
+    m_CQRing = singleMap ? m_SQRing : lf_Map(m_CQRingSize, IORING_OFF_CQ_RING);
+    m_SQEsSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    m_SQEs = static_cast<io_uring_sqe *>(lf_Map(m_SQEsSize, IORING_OFF_SQES));
+
+    char *sq = static_cast<char *>(m_SQRing);
+    m_SQHead = reinterpret_cast<unsigned *>(sq + params.sq_off.head);
+    m_SQTail = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+    m_SQMask = reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+    m_SQArray = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+    char *cq = static_cast<char *>(m_CQRing);
+    m_CQHead = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+    m_CQTail = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+    m_CQMask = reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+    m_CQEs = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+
+    // never more requests in flight than sq entries, so the completion
+    // queue, at least as large, can't overflow
+    m_Requests.resize(params.sq_entries);
+    m_FreeSlots.clear();
+    for (size_t i = m_Requests.size(); i > 0; --i)
+    {
+        m_FreeSlots.push_back(i - 1);
+    }
+    m_ToSubmit = 0;
+}
+
+void FileIOUring::DestroyRing()
+{
+    if (m_SQEs)
+    {
+        munmap(m_SQEs, m_SQEsSize);
+        m_SQEs = nullptr;
+    }
+    if (m_CQRing && m_CQRing != m_SQRing)
+    {
+        munmap(m_CQRing, m_CQRingSize);
+    }
+    m_CQRing = nullptr;
+    if (m_SQRing)
+    {
+        munmap(m_SQRing, m_SQRingSize);
+        m_SQRing = nullptr;
+    }
+    if (m_RingFD != -1)
+    {
+        close(m_RingFD);
+        m_RingFD = -1;
+    }
+}
+
+void FileIOUring::Queue(Operation &op, char *buffer, size_t size,
+                        size_t offset, const bool isWrite)
+{
+    while (size > 0)
+    {
+        const size_t chunk = std::min(size, m_ChunkSize);
+        while (m_FreeSlots.empty())
+        {
+            Submit();
+            Reap();
+        }
+        const size_t slot = m_FreeSlots.back();
+        m_FreeSlots.pop_back();
+        m_Requests[slot] = {&op, buffer, chunk, offset, isWrite};
+        ++op.Pending;
+        PrepareRequest(slot);
+
+        buffer += chunk;
+        offset += chunk;
+        size -= chunk;
+    }
+}
+
+void FileIOUring::PrepareRequest(const size_t slot)
+{
+    const Request &request = m_Requests[slot];
+    // only this thread adds to the submission queue
+    const unsigned tail = *m_SQTail;
+    const unsigned index = tail & *m_SQMask;
+    struct io_uring_sqe &sqe = m_SQEs[index];
+
+    std::memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode = request.IsWrite ? IORING_OP_WRITE : IORING_OP_READ;
+    sqe.fd = m_FileDescriptor;
+    sqe.addr = reinterpret_cast<uint64_t>(request.Buffer);
+    sqe.len = static_cast<uint32_t>(request.Size);
+    sqe.off = request.Offset;
+    sqe.user_data = slot;
+    m_SQArray[index] = index;
+    __atomic_store_n(m_SQTail, tail + 1, __ATOMIC_RELEASE);
+    ++m_ToSubmit;
+}
+
+void FileIOUring::Submit()
+{
+    while (m_ToSubmit > 0)
+    {
+        errno = 0;
+        const long submitted = syscall(__NR_io_uring_enter, m_RingFD,
+                                       m_ToSubmit, 0, 0, nullptr, 0);
+        if (submitted == -1)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            if ((errno == EAGAIN || errno == EBUSY) &&
+                m_FreeSlots.size() + m_ToSubmit < m_Requests.size())
+            {
+                // out of kernel resources, make room by completing some
+                Reap();
+                continue;
+            }
+            m_Errno = errno;
+            throw std::ios_base::failure(
+                "ERROR: couldn't submit requests for file " + m_Name +
+                ", in call to IOUring io_uring_enter" + SysErrMsg());
+        }
+        m_ToSubmit -= static_cast<unsigned>(submitted);
+    }
+}
+
+void FileIOUring::Reap()
+{
+    unsigned head = *m_CQHead;
+    const unsigned tail = __atomic_load_n(m_CQTail, __ATOMIC_ACQUIRE);
+
+    if (head == tail)
+    {
+        errno = 0;
+        if (syscall(__NR_io_uring_enter, m_RingFD, 0, 1,
+                    IORING_ENTER_GETEVENTS, nullptr, 0) == -1 &&
+            errno != EINTR)
+        {
+            m_Errno = errno;
+            throw std::ios_base::failure(
+                "ERROR: couldn't wait for requests on file " + m_Name +
+                ", in call to IOUring io_uring_enter" + SysErrMsg());
+        }
+        return;
+    }
+
+    for (; head != tail; ++head)
+    {
+        const struct io_uring_cqe &cqe = m_CQEs[head & *m_CQMask];
+        const size_t slot = static_cast<size_t>(cqe.user_data);
+        const int result = cqe.res;
+        Request &request = m_Requests[slot];
+        Operation &op = *request.Op;
+
+        if (result == -EINTR || result == -EAGAIN)
+        {
+            PrepareRequest(slot);
+            continue;
+        }
+        if (result < 0)
+        {
+            op.Error = op.Error ? op.Error : -result;
+        }
+        else if (result == 0)
+        {
+            // reading past the end of the file
+            op.Error = op.Error ? op.Error : EIO;
+        }
+        else
+        {
+            if (op.OpStatus)
+            {
+                op.OpStatus->Bytes += static_cast<size_t>(result);
+            }
+            if (static_cast<size_t>(result) < request.Size)
+            {
+                // short read or write, ask for the rest
+                request.Buffer += result;
+                request.Offset += result;
+                request.Size -= result;
+                PrepareRequest(slot);
+                continue;
+            }
+        }
+
+        m_FreeSlots.push_back(slot);
+        if (--op.Pending == 0 && op.OpStatus)
+        {
+            op.OpStatus->Running = false;
+            op.OpStatus->Successful = (op.Error == 0);
+        }
+    }
+    __atomic_store_n(m_CQHead, head, __ATOMIC_RELEASE);
+}
+
+void FileIOUring::Wait(Operation &op)
+{
+    Submit();
+    while (op.Pending > 0)
+    {
+        Reap();
+        Submit();
+    }
+}
+
+void FileIOUring::WaitAll()
+{
+    if (m_RingFD == -1)
+    {
+        return;
+    }
+    Submit();
+    while (m_FreeSlots.size() < m_Requests.size())
+    {
+        Reap();
+        Submit();
+    }
+    m_AsyncOperations.clear();
+}
+
+void FileIOUring::CheckFile(const std::string hint) const
+{
+    if (m_FileDescriptor == -1)
+    {
+        throw std::ios_base::failure("ERROR: " + hint + SysErrMsg());
+    }
+}
+
+std::string FileIOUring::SysErrMsg() const
+{
+    return std::string(": errno = " + std::to_string(m_Errno) + ": " +
+                       strerror(m_Errno));
+}
+
+} // end namespace transport
+} // end namespace adios2
@@ -0,0 +1,159 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileIOUring.h file I/O through a Linux io_uring submission/completion ring
+ *
+ */
+
+#ifndef ADIOS2_TOOLKIT_TRANSPORT_FILE_FILEIOURING_H_
+#define ADIOS2_TOOLKIT_TRANSPORT_FILE_FILEIOURING_H_
+
+#include <memory>
+#include <vector>
+
+#include "adios2/common/ADIOSConfig.h"
+#include "adios2/toolkit/transport/Transport.h"
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace adios2
+{
+namespace helper
+{
+class Comm;
+}
+namespace transport
+{
+
+/**
+ * File transport that keeps many requests in flight through an io_uring.
+ * Write, WriteV and Read split the data in ChunkSize pieces that are all
+ * submitted together before waiting, IWrite and IRead only queue them and
+ * return, their Status is final after the next Flush or Close.
+ * Parameters: QueueDepth (ring entries, default 64) and ChunkSize (bytes,
+ * default 4MB).
+ */
+class FileIOUring : public Transport
+{
+
+public:
+    FileIOUring(helper::Comm const &comm);
+
+    ~FileIOUring();
+
+    /** Async option is ignored in FileIOUring transport */
+    void Open(const std::string &name, const Mode openMode,
+              const bool async = false) final;
+
+    void SetParameters(const Params &parameters) final;
+
+    void Write(const char *buffer, size_t size, size_t start = MaxSizeT) final;
+
+    /** buffer must stay unchanged until status.Running is false */
+    void IWrite(const char *buffer, size_t size, Status &status,
+                size_t start = MaxSizeT) final;
+
+    /** Submits all regions as one batch */
+    void WriteV(const core::iovec *iov, const int iovcnt,
+                size_t start = MaxSizeT) final;
+
+    void Read(char *buffer, size_t size, size_t start = MaxSizeT) final;
+
+    /** buffer may only be used once status.Running is false */
+    void IRead(char *buffer, size_t size, Status &status,
+               size_t start = MaxSizeT) final;
+
+    size_t GetSize() final;
+
+    /** Waits for all requests queued by IWrite and IRead */
+    void Flush() final;
+
+    void Close() final;
+
+    void Delete() final;
+
+    void SeekToEnd() final;
+
+    void SeekToBegin() final;
+
+private:
+    /** POSIX file handle returned by Open */
+    int m_FileDescriptor = -1;
+    int m_Errno = 0;
+    /** position used by requests without a start */
+    size_t m_Offset = 0;
+
+    unsigned int m_QueueDepth = 64;
+    size_t m_ChunkSize = 4 * 1024 * 1024;
+
+    /** one IWrite/IRead/Write/Read/WriteV call, done when Pending is 0 */
+    struct Operation
+    {
+        Status *OpStatus;
+        size_t Pending;
+        int Error; // first errno of a failed request
+    };
+
+    /** one chunk of an Operation, in flight in the ring */
+    struct Request
+    {
+        Operation *Op;
+        char *Buffer;
+        size_t Size;
+        size_t Offset;
+        bool IsWrite;
+    };
+
+    /** the ring, mapped from the kernel */
+    int m_RingFD = -1;
+    void *m_SQRing = nullptr;
+    size_t m_SQRingSize = 0;
+    void *m_CQRing = nullptr;
+    size_t m_CQRingSize = 0;
+    io_uring_sqe *m_SQEs = nullptr;
+    size_t m_SQEsSize = 0;
+    io_uring_cqe *m_CQEs = nullptr;
+    unsigned int *m_SQHead = nullptr;
+    unsigned int *m_SQTail = nullptr;
+    unsigned int *m_SQMask = nullptr;
+    unsigned int *m_SQArray = nullptr;
+    unsigned int *m_CQHead = nullptr;
+    unsigned int *m_CQTail = nullptr;
+    unsigned int *m_CQMask = nullptr;
+
+    /** request slots, indexed by the sqe user_data */
+    std::vector<Request> m_Requests;
+    std::vector<size_t> m_FreeSlots;
+    /** sqes filled in but not handed to the kernel yet */
+    unsigned int m_ToSubmit = 0;
+    /** asynchronous operations not completed yet */
+    std::vector<std::unique_ptr<Operation>> m_AsyncOperations;
+
+    void SetupRing();
+    void DestroyRing();
+
+    /** Splits a request in chunks and puts them in the ring, submitting and
+     * reaping completions whenever the ring is full */
+    void Queue(Operation &op, char *buffer, size_t size, size_t offset,
+               const bool isWrite);
+    void PrepareRequest(const size_t slot);
+    void Submit();
+    /** Handles completions, waiting for at least one */
+    void Reap();
+    void Wait(Operation &op);
+    void WaitAll();
+
+    /**
+     * Check if m_FileDescriptor is -1 after an operation
+     * @param hint exception message
+     */
+    void CheckFile(const std::string hint) const;
+    std::string SysErrMsg() const;
+};
+
+} // end namespace transport
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_TRANSPORT_FILE_FILEIOURING_H_ */
@@ -0,0 +1,216 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileMMap.cpp read-only file access through a memory mapping
+ *
+ */
+#include "FileMMap.h"
+
+#include <cstring>     // memcpy, strerror
+#include <errno.h>     // errno
+#include <fcntl.h>     // open
+#include <sys/mman.h>  // mmap, munmap
+#include <sys/stat.h>  // fstat
+#include <sys/types.h> // open
+#include <unistd.h>    // close
+
+/// \cond EXCLUDE_FROM_DOXYGEN
+#include <ios> //std::ios_base::failure
+/// \endcond
+
+namespace adios2
+{
+namespace transport
+{
+
+FileMMap::FileMMap(helper::Comm const &comm) : Transport("File", "MMap", comm)
+{
+}
+
+FileMMap::~FileMMap()
+{
+    if (m_IsOpen)
+    {
+        Unmap();
+        close(m_FileDescriptor);
+    }
+}
+
+void FileMMap::Open(const std::string &name, const Mode openMode,
+                    const bool /*async*/)
+{
+    m_Name = name;
+    CheckName();
+    m_OpenMode = openMode;
+    if (m_OpenMode != Mode::Read)
+    {
+        throw std::invalid_argument(
+            "ERROR: MMap transport is read-only, can't open file " + m_Name +
+            " for writing, in call to MMap open\n");
+    }
+
+    ProfilerStart("open");
+    errno = 0;
+    m_FileDescriptor = open(m_Name.c_str(), O_RDONLY);
+    m_Errno = errno;
+    ProfilerStop("open");
+    CheckFile("couldn't open file " + m_Name + ", in call to MMap open");
+
+    m_Offset = 0;
+    m_IsOpen = true;
+}
+
+void FileMMap::Write(const char * /*buffer*/, size_t /*size*/,
+                     size_t /*start*/)
+{
+    throw std::invalid_argument("ERROR: MMap transport is read-only, can't "
+                                "write to file " +
+                                m_Name + ", in call to MMap Write\n");
+}
+
+void FileMMap::Read(char *buffer, size_t size, size_t start)
+{
+    const bool positional = (start != MaxSizeT);
+    const size_t offset = positional ? start : m_Offset;
+
+    ProfilerStart("read");
+    const char *mapping =
+        Map(size, offset, "couldn't read from file " + m_Name);
+    std::memcpy(buffer, mapping + offset, size);
+    ProfilerStop("read");
+
+    if (!positional)
+    {
+        m_Offset += size;
+    }
+}
+
+const char *FileMMap::ReadInPlace(size_t size, size_t start)
+{
+    return Map(size, start, "couldn't access file " + m_Name) + start;
+}
+
+size_t FileMMap::GetSize()
+{
+    struct stat fileStat;
+    errno = 0;
+    if (fstat(m_FileDescriptor, &fileStat) == -1)
+    {
+        throw std::ios_base::failure("ERROR: couldn't get size of file " +
+                                     m_Name + SysErrMsg(errno));
+    }
+    return static_cast<size_t>(fileStat.st_size);
+}
+
+void FileMMap::Flush() {}
+
+void FileMMap::Close()
+{
+    ProfilerStart("close");
+    Unmap();
+    errno = 0;
+    const int status = close(m_FileDescriptor);
+    m_Errno = errno;
+    ProfilerStop("close");
+
+    if (status == -1)
+    {
+        throw std::ios_base::failure("ERROR: couldn't close file " + m_Name +
+                                     ", in call to MMap close" +
+                                     SysErrMsg(m_Errno));
+    }
+
+    m_IsOpen = false;
+}
+
+void FileMMap::Delete()
+{
+    throw std::invalid_argument("ERROR: MMap transport is read-only, can't "
+                                "delete file " +
+                                m_Name + ", in call to MMap Delete\n");
+}
+
+void FileMMap::SeekToEnd() { m_Offset = GetSize(); }
+
+void FileMMap::SeekToBegin() { m_Offset = 0; }
+
+bool FileMMap::IsThreadSafe() const noexcept { return true; }
+
+char *FileMMap::Map(const size_t size, const size_t start,
+                    const std::string &hint)
+{
+    std::lock_guard<std::mutex> lock(m_MappingMutex);
+    if (m_Mapping != nullptr && start + size <= m_MappedSize)
+    {
+        return m_Mapping;
+    }
+
+    // the file grew, or this is the first access
+    const size_t fileSize = GetSize();
+    if (start + size > fileSize)
+    {
+        throw std::ios_base::failure(
+            "ERROR: " + hint + ", range " + std::to_string(start) + "+" +
+            std::to_string(size) + " is beyond the file size " +
+            std::to_string(fileSize) + ", in call to MMap mmap\n");
+    }
+    if (fileSize == 0)
+    {
+        // nothing to map, only empty ranges of an empty file get here
+        static char empty = '\0';
+        return &empty;
+    }
+
+    errno = 0;
+    void *mapping =
+        mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, m_FileDescriptor, 0);
+    if (mapping == MAP_FAILED)
+    {
+        throw std::ios_base::failure("ERROR: " + hint +
+                                     ", in call to MMap mmap" +
+                                     SysErrMsg(errno));
+    }
+
+    // pointers given out by ReadInPlace stay valid until Close
+    if (m_Mapping != nullptr)
+    {
+        m_OldMappings.emplace_back(m_Mapping, m_MappedSize);
+    }
+    m_Mapping = static_cast<char *>(mapping);
+    m_MappedSize = fileSize;
+    return m_Mapping;
+}
+
+void FileMMap::Unmap()
+{
+    std::lock_guard<std::mutex> lock(m_MappingMutex);
+    for (const auto &old : m_OldMappings)
+    {
+        munmap(old.first, old.second);
+    }
+    m_OldMappings.clear();
+    if (m_Mapping != nullptr)
+    {
+        munmap(m_Mapping, m_MappedSize);
+        m_Mapping = nullptr;
+        m_MappedSize = 0;
+    }
+}
+
+void FileMMap::CheckFile(const std::string hint) const
+{
+    if (m_FileDescriptor == -1)
+    {
+        throw std::ios_base::failure("ERROR: " + hint + SysErrMsg(m_Errno));
+    }
+}
+
+std::string FileMMap::SysErrMsg(const int err) const
+{
+    return std::string(": errno = " + std::to_string(err) + ": " +
+                       strerror(err));
+}
+
+} // end namespace transport
+} // end namespace adios2
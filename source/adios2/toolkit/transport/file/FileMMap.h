@@ -0,0 +1,104 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileMMap.h read-only file access through a memory mapping
+ *
+ */
+
+#ifndef ADIOS2_TOOLKIT_TRANSPORT_FILE_FILEMMAP_H_
+#define ADIOS2_TOOLKIT_TRANSPORT_FILE_FILEMMAP_H_
+
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "adios2/common/ADIOSConfig.h"
+#include "adios2/toolkit/transport/Transport.h"
+
+namespace adios2
+{
+namespace helper
+{
+class Comm;
+}
+namespace transport
+{
+
+/**
+ * Read-only file transport that maps the whole file in memory. Read copies
+ * from the mapped pages, ReadInPlace hands them out without a copy. A file
+ * that grew since Open (e.g. a stream still being written) is mapped again
+ * on demand, earlier mappings stay valid until Close.
+ */
+class FileMMap : public Transport
+{
+
+public:
+    FileMMap(helper::Comm const &comm);
+
+    ~FileMMap();
+
+    /** Only Mode::Read is supported, async option is ignored */
+    void Open(const std::string &name, const Mode openMode,
+              const bool async = false) final;
+
+    /** Throws, the transport is read-only */
+    void Write(const char *buffer, size_t size, size_t start = MaxSizeT) final;
+
+    void Read(char *buffer, size_t size, size_t start = MaxSizeT) final;
+
+    const char *ReadInPlace(size_t size, size_t start) final;
+
+    size_t GetSize() final;
+
+    /** Does nothing, nothing is ever written */
+    void Flush() final;
+
+    void Close() final;
+
+    /** Throws, the transport is read-only */
+    void Delete() final;
+
+    void SeekToEnd() final;
+
+    void SeekToBegin() final;
+
+    /** Read with a start and ReadInPlace can run concurrently */
+    bool IsThreadSafe() const noexcept final;
+
+private:
+    /** POSIX file handle returned by Open */
+    int m_FileDescriptor = -1;
+    int m_Errno = 0;
+    /** position used by reads without a start */
+    size_t m_Offset = 0;
+
+    /** current mapping of the file, m_MappedSize bytes */
+    char *m_Mapping = nullptr;
+    size_t m_MappedSize = 0;
+    /** mappings replaced by a larger one, kept until Close */
+    std::vector<std::pair<char *, size_t>> m_OldMappings;
+    /** guards m_Mapping and m_MappedSize when the file is mapped again */
+    std::mutex m_MappingMutex;
+
+    /**
+     * Returns the mapping after making sure it covers [start, start+size)
+     * @param hint exception message
+     */
+    char *Map(const size_t size, const size_t start, const std::string &hint);
+
+    void Unmap();
+
+    /**
+     * Check if m_FileDescriptor is -1 after an operation
+     * @param hint exception message
+     */
+    void CheckFile(const std::string hint) const;
+    std::string SysErrMsg(const int err) const;
+};
+
+} // end namespace transport
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_TRANSPORT_FILE_FILEMMAP_H_ */
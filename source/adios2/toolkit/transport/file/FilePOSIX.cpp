@@ -9,6 +9,8 @@
  */
 #include "FilePOSIX.h"
 
+#include <algorithm>   // std::min
+#include <climits>     // IOV_MAX
 #include <cstdio>      // remove
 #include <cstring>     // strerror
 #include <errno.h>     // errno
@@ -16,6 +18,7 @@
 #include <stddef.h>    // write output
 #include <sys/stat.h>  // open, fstat
 #include <sys/types.h> // open
+#include <sys/uio.h>   // writev
 #include <unistd.h>    // write, close
 
 /// \cond EXCLUDE_FROM_DOXYGEN
@@ -122,47 +125,43 @@ void FilePOSIX::Open(const std::string &name, const Mode openMode,
 
 void FilePOSIX::Write(const char *buffer, size_t size, size_t start)
 {
+    // with a start position pwrite leaves the file position and the
+    // members alone, so positional writes can run concurrently
+    const bool positional = (start != MaxSizeT);
     auto lf_Write = [&](const char *buffer, size_t size) {
         while (size > 0)
         {
             ProfilerStart("write");
             errno = 0;
-            const auto writtenSize = write(m_FileDescriptor, buffer, size);
-            m_Errno = errno;
+            const auto writtenSize =
+                positional ? pwrite(m_FileDescriptor, buffer, size,
+                                    static_cast<off_t>(start))
+                           : write(m_FileDescriptor, buffer, size);
+            const int err = errno;
             ProfilerStop("write");
 
             if (writtenSize == -1)
             {
-                if (errno == EINTR)
+                if (err == EINTR)
                 {
                     continue;
                 }
 
                 throw std::ios_base::failure(
                     "ERROR: couldn't write to file " + m_Name +
-                    ", in call to POSIX Write" + SysErrMsg());
+                    ", in call to POSIX Write" + SysErrMsg(err));
             }
 
             buffer += writtenSize;
             size -= writtenSize;
+            if (positional)
+            {
+                start += writtenSize;
+            }
         }
     };
 
     WaitForOpen();
-    if (start != MaxSizeT)
-    {
-        errno = 0;
-        const auto newPosition = lseek(m_FileDescriptor, start, SEEK_SET);
-        m_Errno = errno;
-
-        if (static_cast<size_t>(newPosition) != start)
-        {
-            throw std::ios_base::failure(
-                "ERROR: couldn't move to start position " +
-                std::to_string(start) + " in file " + m_Name +
-                ", in call to POSIX lseek" + SysErrMsg());
-        }
-    }
 
     if (size > DefaultMaxFileBatchSize)
     {
@@ -183,51 +182,144 @@ void FilePOSIX::Write(const char *buffer, size_t size, size_t start)
     }
 }
 
+void FilePOSIX::WriteV(const core::iovec *iov, const int iovcnt, size_t start)
+{
+#ifdef IOV_MAX
+    const int maxBatch = IOV_MAX;
+#else
+    const int maxBatch = 1024;
+#endif
+
+    // same as Write, a start position means pwritev at that offset
+    const bool positional = (start != MaxSizeT);
+    auto lf_WriteV = [&](const struct ::iovec *batch,
+                         const int count) -> ssize_t {
+        if (!positional)
+        {
+            return writev(m_FileDescriptor, batch, count);
+        }
+#ifdef __linux__
+        return pwritev(m_FileDescriptor, batch, count,
+                       static_cast<off_t>(start));
+#else
+        // no pwritev everywhere, write the regions one by one
+        ssize_t total = 0;
+        for (int i = 0; i < count; ++i)
+        {
+            const ssize_t written =
+                pwrite(m_FileDescriptor, batch[i].iov_base, batch[i].iov_len,
+                       static_cast<off_t>(start + total));
+            if (written == -1)
+            {
+                return (total > 0 ? total : -1);
+            }
+            total += written;
+            if (static_cast<size_t>(written) < batch[i].iov_len)
+            {
+                break;
+            }
+        }
+        return total;
+#endif
+    };
+
+    WaitForOpen();
+
+    // cur is the first region not completely written yet, of which the
+    // first curWritten bytes already made it to the file
+    std::vector<struct ::iovec> batch;
+    batch.reserve(std::min(iovcnt, maxBatch));
+    int cur = 0;
+    size_t curWritten = 0;
+    while (cur < iovcnt)
+    {
+        const int count = std::min(iovcnt - cur, maxBatch);
+        batch.clear();
+        for (int i = cur; i < cur + count; ++i)
+        {
+            const size_t skip = (i == cur ? curWritten : 0);
+            struct ::iovec v;
+            v.iov_base = const_cast<char *>(
+                static_cast<const char *>(iov[i].iov_base) + skip);
+            v.iov_len = std::min(iov[i].iov_len - skip,
+                                 DefaultMaxFileBatchSize);
+            batch.push_back(v);
+        }
+
+        ProfilerStart("write");
+        errno = 0;
+        const auto writtenSize = lf_WriteV(batch.data(), count);
+        const int err = errno;
+        ProfilerStop("write");
+
+        if (writtenSize == -1)
+        {
+            if (err == EINTR)
+            {
+                continue;
+            }
+
+            throw std::ios_base::failure("ERROR: couldn't write to file " +
+                                         m_Name + ", in call to POSIX writev" +
+                                         SysErrMsg(err));
+        }
+
+        if (positional)
+        {
+            start += static_cast<size_t>(writtenSize);
+        }
+
+        // skip over the regions (partially) written by this call
+        size_t remaining = curWritten + static_cast<size_t>(writtenSize);
+        while (cur < iovcnt && remaining >= iov[cur].iov_len)
+        {
+            remaining -= iov[cur].iov_len;
+            ++cur;
+        }
+        curWritten = remaining;
+    }
+}
+
 void FilePOSIX::Read(char *buffer, size_t size, size_t start)
 {
+    // with a start position pread leaves the file position and the
+    // members alone, so positional reads can run concurrently
+    const bool positional = (start != MaxSizeT);
     auto lf_Read = [&](char *buffer, size_t size) {
         while (size > 0)
         {
             ProfilerStart("read");
             errno = 0;
-            const auto readSize = read(m_FileDescriptor, buffer, size);
-            m_Errno = errno;
+            const auto readSize =
+                positional ? pread(m_FileDescriptor, buffer, size,
+                                   static_cast<off_t>(start))
+                           : read(m_FileDescriptor, buffer, size);
+            const int err = errno;
             ProfilerStop("read");
 
             if (readSize == -1)
             {
-                if (errno == EINTR)
+                if (err == EINTR)
                 {
                     continue;
                 }
 
                 throw std::ios_base::failure(
                     "ERROR: couldn't read from file " + m_Name +
-                    ", in call to POSIX IO read" + SysErrMsg());
+                    ", in call to POSIX IO read" + SysErrMsg(err));
             }
 
             buffer += readSize;
             size -= readSize;
+            if (positional)
+            {
+                start += readSize;
+            }
         }
     };
 
     WaitForOpen();
 
-    if (start != MaxSizeT)
-    {
-        errno = 0;
-        const auto newPosition = lseek(m_FileDescriptor, start, SEEK_SET);
-        m_Errno = errno;
-
-        if (static_cast<size_t>(newPosition) != start)
-        {
-            throw std::ios_base::failure(
-                "ERROR: couldn't move to start position " +
-                std::to_string(start) + " in file " + m_Name +
-                ", in call to POSIX lseek" + SysErrMsg());
-        }
-    }
-
     if (size > DefaultMaxFileBatchSize)
     {
         const size_t batches = size / DefaultMaxFileBatchSize;
@@ -301,12 +393,16 @@ void FilePOSIX::CheckFile(const std::string hint) const
     }
 }
 
-std::string FilePOSIX::SysErrMsg() const
+std::string FilePOSIX::SysErrMsg() const { return SysErrMsg(m_Errno); }
+
+std::string FilePOSIX::SysErrMsg(const int err) const
 {
-    return std::string(": errno = " + std::to_string(m_Errno) + ": " +
-                       strerror(m_Errno));
+    return std::string(": errno = " + std::to_string(err) + ": " +
+                       strerror(err));
 }
 
+bool FilePOSIX::IsThreadSafe() const noexcept { return true; }
+
 void FilePOSIX::SeekToEnd()
 {
     WaitForOpen();
@@ -25,7 +25,12 @@ class Comm;
 namespace transport
 {
 
-/** File descriptor transport using the POSIX IO library */
+/**
+ * File descriptor transport using the POSIX IO library. Read, Write and
+ * WriteV with a start position use pread/pwrite/pwritev, they are
+ * thread-safe once Open has completed and don't move the file position
+ * used by calls without a start.
+ */
 class FilePOSIX : public Transport
 {
 
@@ -39,6 +44,9 @@ public:
 
     void Write(const char *buffer, size_t size, size_t start = MaxSizeT) final;
 
+    void WriteV(const core::iovec *iov, const int iovcnt,
+                size_t start = MaxSizeT) final;
+
     void Read(char *buffer, size_t size, size_t start = MaxSizeT) final;
 
     size_t GetSize() final;
@@ -54,6 +62,9 @@ public:
 
     void SeekToBegin() final;
 
+    /** Positional Read/Write/WriteV can run concurrently */
+    bool IsThreadSafe() const noexcept final;
+
 private:
     /** POSIX file handle returned by Open */
     int m_FileDescriptor = -1;
@@ -68,6 +79,7 @@ private:
     void CheckFile(const std::string hint) const;
     void WaitForOpen();
     std::string SysErrMsg() const;
+    std::string SysErrMsg(const int err) const;
 };
 
 } // end namespace transport
@@ -17,6 +17,7 @@
 
 /// transports
 #ifndef _WIN32
+#include "adios2/toolkit/transport/file/FileMMap.h"
 #include "adios2/toolkit/transport/file/FilePOSIX.h"
 #endif
 #ifdef ADIOS2_HAVE_DAOS
@@ -25,6 +26,9 @@
 #ifdef ADIOS2_HAVE_IME
 #include "adios2/toolkit/transport/file/FileIME.h"
 #endif
+#ifdef ADIOS2_HAVE_IOURING
+#include "adios2/toolkit/transport/file/FileIOUring.h"
+#endif
 
 #ifdef _WIN32
 #pragma warning(disable : 4503) // length of std::function inside std::async
@@ -96,6 +100,8 @@ void TransportMan::OpenFiles(const std::vector<std::string> &fileNames,
             std::shared_ptr<Transport> file =
                 OpenFileTransport(fileNames[i], openMode, parameters, profile);
             m_Transports.insert({i, file});
+            m_ReadMutexes.emplace(i, std::unique_ptr<std::mutex>(
+                                         new std::mutex()));
         }
     }
 }
@@ -107,6 +113,7 @@ void TransportMan::OpenFileID(const std::string &name, const size_t id,
     std::shared_ptr<Transport> file =
         OpenFileTransport(name, mode, parameters, profile);
     m_Transports.insert({id, file});
+    m_ReadMutexes.emplace(id, std::unique_ptr<std::mutex>(new std::mutex()));
 }
 
 std::vector<std::string> TransportMan::GetFilesBaseNames(
@@ -201,6 +208,29 @@ void TransportMan::WriteFiles(const char *buffer, const size_t size,
     }
 }
 
+void TransportMan::WriteFiles(const core::iovec *iov, const size_t iovcnt,
+                              const int transportIndex)
+{
+    if (transportIndex == -1)
+    {
+        for (auto &transportPair : m_Transports)
+        {
+            auto &transport = transportPair.second;
+            if (transport->m_Type == "File")
+            {
+                transport->WriteV(iov, static_cast<int>(iovcnt));
+            }
+        }
+    }
+    else
+    {
+        auto itTransport = m_Transports.find(transportIndex);
+        CheckFile(itTransport, ", in call to WriteFiles with index " +
+                                   std::to_string(transportIndex));
+        itTransport->second->WriteV(iov, static_cast<int>(iovcnt));
+    }
+}
+
 void TransportMan::WriteFileAt(const char *buffer, const size_t size,
                                const size_t start, const int transportIndex)
 {
@@ -224,6 +254,29 @@ void TransportMan::WriteFileAt(const char *buffer, const size_t size,
     }
 }
 
+void TransportMan::WriteFileAt(const core::iovec *iov, const size_t iovcnt,
+                               const size_t start, const int transportIndex)
+{
+    if (transportIndex == -1)
+    {
+        for (auto &transportPair : m_Transports)
+        {
+            auto &transport = transportPair.second;
+            if (transport->m_Type == "File")
+            {
+                transport->WriteV(iov, static_cast<int>(iovcnt), start);
+            }
+        }
+    }
+    else
+    {
+        auto itTransport = m_Transports.find(transportIndex);
+        CheckFile(itTransport, ", in call to WriteFileAt with index " +
+                                   std::to_string(transportIndex));
+        itTransport->second->WriteV(iov, static_cast<int>(iovcnt), start);
+    }
+}
+
 void TransportMan::SeekToFileEnd(const int transportIndex)
 {
     if (transportIndex == -1)
@@ -282,7 +335,34 @@ void TransportMan::ReadFile(char *buffer, const size_t size, const size_t start,
     auto itTransport = m_Transports.find(transportIndex);
     CheckFile(itTransport, ", in call to ReadFile with index " +
                                std::to_string(transportIndex));
-    itTransport->second->Read(buffer, size, start);
+    if (itTransport->second->IsThreadSafe())
+    {
+        itTransport->second->Read(buffer, size, start);
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lock(
+            *m_ReadMutexes.at(transportIndex));
+        itTransport->second->Read(buffer, size, start);
+    }
+}
+
+const char *TransportMan::ReadFileInPlace(const size_t size,
+                                          const size_t start,
+                                          const size_t transportIndex)
+{
+    auto itTransport = m_Transports.find(transportIndex);
+    CheckFile(itTransport, ", in call to ReadFileInPlace with index " +
+                               std::to_string(transportIndex));
+    return itTransport->second->ReadInPlace(size, start);
+}
+
+bool TransportMan::FileIsThreadSafe(const size_t transportIndex) const
+{
+    auto itTransport = m_Transports.find(transportIndex);
+    CheckFile(itTransport, ", in call to FileIsThreadSafe with index " +
+                               std::to_string(transportIndex));
+    return itTransport->second->IsThreadSafe();
 }
 
 void TransportMan::FlushFiles(const int transportIndex)
@@ -440,6 +520,16 @@ TransportMan::OpenFileTransport(const std::string &fileName,
                     " transport does not support buffered I/O.");
             }
         }
+        else if (library == "MMap" || library == "mmap")
+        {
+            transport = std::make_shared<transport::FileMMap>(m_Comm);
+            if (lf_GetBuffered("false"))
+            {
+                throw std::invalid_argument(
+                    "ERROR: " + library +
+                    " transport does not support buffered I/O.");
+            }
+        }
 #endif
 #ifdef ADIOS2_HAVE_DAOS
         else if (library == "Daos" || library == "daos")
@@ -458,6 +548,18 @@ TransportMan::OpenFileTransport(const std::string &fileName,
         {
             transport = std::make_shared<transport::FileIME>(m_Comm);
         }
+#endif
+#ifdef ADIOS2_HAVE_IOURING
+        else if (library == "IOUring" || library == "iouring")
+        {
+            transport = std::make_shared<transport::FileIOUring>(m_Comm);
+            if (lf_GetBuffered("false"))
+            {
+                throw std::invalid_argument(
+                    "ERROR: " + library +
+                    " transport does not support buffered I/O.");
+            }
+        }
 #endif
         else if (library == "NULL" || library == "null")
         {
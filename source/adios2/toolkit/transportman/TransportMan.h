@@ -13,6 +13,7 @@
 
 #include <future> //std::async, std::future
 #include <memory> //std::shared_ptr
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -118,6 +119,16 @@ public:
     void WriteFiles(const char *buffer, const size_t size,
                     const int transportIndex = -1);
 
+    /**
+     * Write a list of memory regions back to back to file transports with a
+     * single vectored call per transport
+     * @param iov memory regions to be written, in order
+     * @param iovcnt number of regions in iov
+     * @param transportIndex
+     */
+    void WriteFiles(const core::iovec *iov, const size_t iovcnt,
+                    const int transportIndex = -1);
+
     /**
      * Write data to a specific location in files
      * @param transportIndex
@@ -127,10 +138,25 @@ public:
     void WriteFileAt(const char *buffer, const size_t size, const size_t start,
                      const int transportIndex = -1);
 
+    /**
+     * Write a list of memory regions back to back to a specific location in
+     * files
+     * @param iov memory regions to be written, in order
+     * @param iovcnt number of regions in iov
+     * @param start file offset of the first region
+     * @param transportIndex
+     */
+    void WriteFileAt(const core::iovec *iov, const size_t iovcnt,
+                     const size_t start, const int transportIndex = -1);
+
     size_t GetFileSize(const size_t transportIndex = 0) const;
 
     /**
-     * Read contents from a single file and assign it to buffer
+     * Read contents from a single file and assign it to buffer. Several
+     * threads can call ReadFile at the same time, also on the same
+     * transportIndex, as long as no file is opened or closed meanwhile.
+     * Transports with thread-safe positional reads run those calls
+     * concurrently, on other transports they run one at a time.
      * @param buffer
      * @param size
      * @param start
@@ -139,6 +165,26 @@ public:
     void ReadFile(char *buffer, const size_t size, const size_t start = 0,
                   const size_t transportIndex = 0);
 
+    /**
+     * Access contents of a single file without copying them, only for
+     * transports that map the file in memory (e.g. MMap). Can be called
+     * concurrently like ReadFile.
+     * @param size
+     * @param start
+     * @param transportIndex
+     * @return address valid until the file is closed, nullptr if the
+     * transport doesn't support it, then use ReadFile
+     */
+    const char *ReadFileInPlace(const size_t size, const size_t start,
+                                const size_t transportIndex = 0);
+
+    /**
+     * Tells if positional reads and writes on a file can run concurrently
+     * @param transportIndex index in m_Transports
+     * @return true: ReadFile calls on transportIndex overlap
+     */
+    bool FileIsThreadSafe(const size_t transportIndex = 0) const;
+
     /**
      * Flush file or files depending on transport index. Throws an exception
      * if transport is not a file when transportIndex > -1.
@@ -178,6 +224,10 @@ public:
 protected:
     helper::Comm const &m_Comm;
 
+    /** serializes ReadFile on transports without thread-safe reads, one
+     * mutex per index in m_Transports, created when the file is opened */
+    std::unordered_map<size_t, std::unique_ptr<std::mutex>> m_ReadMutexes;
+
     std::shared_ptr<Transport> OpenFileTransport(const std::string &fileName,
                                                  const Mode openMode,
                                                  const Params &parameters,
@@ -1022,6 +1022,11 @@ template <class T>
 int printVariableInfo(core::Engine *fp, core::IO *io,
                       core::Variable<T> *variable)
 {
+    if (variable->m_DeferredMetadata)
+    {
+        fp->LoadDeferredMetadata(*variable);
+    }
+
     size_t nsteps = variable->GetAvailableStepsCount();
     if (timestep)
     {
@@ -1483,6 +1488,8 @@ int doList(const char *path)
 
     core::ADIOS adios("C++");
     core::IO &io = adios.DeclareIO("bpls");
+    // BP4 parses the metadata of listed variables only
+    io.SetParameter("LazyMetadata", "true");
     if (timestep)
     {
         // BP4 can process metadata in chuncks to conserve memory
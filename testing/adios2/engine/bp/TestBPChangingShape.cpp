@@ -177,6 +177,48 @@ TEST_F(BPChangingShape, BPWriteReadShape2D)
 
         reader.Close();
     }
+
+    // Reader with lazy metadata parsing (BP4), steps after the first one are
+    // parsed by InquireVariable
+    {
+        adios2::IO inIO = adios.DeclareIO("InputLazy");
+
+        if (!engineName.empty())
+        {
+            inIO.SetEngine(engineName);
+        }
+        inIO.SetParameter("LazyMetadata", "true");
+        adios2::Engine reader = inIO.Open(fname, adios2::Mode::Read);
+
+        auto var = inIO.InquireVariable<double>("v");
+        EXPECT_TRUE(var);
+        EXPECT_EQ(var.Steps(), nsteps);
+        EXPECT_EQ(var.Min(), 0.0);
+        EXPECT_EQ(var.Max(), (nproc - 1) + (nsteps - 1) / 10.0);
+
+        for (size_t i = 0; i < nsteps; i++)
+        {
+            var.SetStepSelection({i, 1});
+            size_t expected_shape = i + 1;
+            EXPECT_EQ(var.Shape()[0], nproc);
+            EXPECT_EQ(var.Shape()[1], expected_shape);
+
+            var.SetSelection({{0, 0}, {static_cast<size_t>(nproc), i + 1}});
+            std::vector<double> data;
+            reader.Get(var, data, adios2::Mode::Sync);
+            ASSERT_EQ(data.size(), nproc * (i + 1));
+            for (size_t r = 0; r < static_cast<size_t>(nproc); r++)
+            {
+                for (size_t j = 0; j <= i; j++)
+                {
+                    EXPECT_EQ(data[r * (i + 1) + j],
+                              r + static_cast<double>(j) / 10.0);
+                }
+            }
+        }
+
+        reader.Close();
+    }
 }
 
 TEST_F(BPChangingShape, MultiBlock)
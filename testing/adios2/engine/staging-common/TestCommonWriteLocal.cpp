@@ -159,14 +159,17 @@ TEST_F(CommonWriteTest, ADIOS2CommonWrite)
         engine.Put(var_i16, data_I16.data(), sync);
         engine.Put(var_i32, data_I32.data(), sync);
         engine.Put(var_i64, data_I64.data(), sync);
-        engine.Put(var_r32, data_R32.data(), sync);
+        // data_R32 is reused for every block, so those Puts can't be deferred
+        const adios2::Mode r32Sync =
+            (LocalCount > 1) ? adios2::Mode::Sync : sync;
+        engine.Put(var_r32, data_R32.data(), r32Sync);
         for (int index = 1; index < LocalCount; index++)
         {
             for (size_t i = 0; i < data_R32.size(); i++)
             {
                 data_R32[i] += 1000.0;
             }
-            engine.Put(var_r32, data_R32.data(), sync);
+            engine.Put(var_r32, data_R32.data(), r32Sync);
         }
         engine.Put(var_r64, data_R64.data(), sync);
         engine.Put(var_c32, data_C32.data(), sync);
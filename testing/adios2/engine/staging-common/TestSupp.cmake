@@ -72,6 +72,7 @@ set (1x1.ForcePreload_CMD "run_test.py.$<CONFIG> -nw 1 -nr 1 --rarg=PreloadMode=
 set (1x1Bulk_CMD "run_test.py.$<CONFIG> -nw 1 -nr 1 --warg=--nx --warg=10000 --warg=--num_steps --warg=101 --rarg=--num_steps --rarg=101")
 set (1x1LockGeometry_CMD "run_test.py.$<CONFIG> -nw 1 -nr 1  --warg=--num_steps --warg=101  --warg=--nx --warg=50 --rarg=--num_steps --rarg=101 --warg=--lock_geometry --rarg=--lock_geometry --rarg=PreloadMode=SstPreloadNone,RENGINE_PARAMS")
 set (2x1_CMD "run_test.py.$<CONFIG> -nw 2 -nr 1")
+set (2x1Bulk_CMD "run_test.py.$<CONFIG> -nw 2 -nr 1 --warg=--nx --warg=20000 --warg=--num_steps --warg=10 --rarg=--num_steps --rarg=10")
 set (2x1ZeroDataVar_CMD "run_test.py.$<CONFIG> -nw 2 -nr 1 --warg=--zero_data_var")
 set (2x1ZeroDataR64_CMD "run_test.py.$<CONFIG> -nw 2 -nr 1  -r $<TARGET_FILE:TestCommonReadR64> --warg=--zero_data_var")
 set (2x1.NoPreload_CMD "run_test.py.$<CONFIG> -nw 2 -nr 1 --rarg=PreloadMode=SstPreloadNone,RENGINE_PARAMS")
@@ -79,6 +80,10 @@ set (2x3.ForcePreload_CMD "run_test.py.$<CONFIG> -nw 2 -nr 3 --rarg=PreloadMode=
 set (2x3.SstRUDP_CMD "run_test.py.$<CONFIG> -nw 2 -nr 3 --rarg=DataTransport=WAN,WANDataTransport=enet,RENGINE_PARAMS --warg=DataTransport=WAN,WANDataTransport=enet,WENGINE_PARAMS")
 set (1x2_CMD "run_test.py.$<CONFIG> -nw 1 -nr 2")
 set (3x5_CMD "run_test.py.$<CONFIG> -nw 3 -nr 5")
+set (1x1.OneStep_CMD "run_test.py.$<CONFIG> -nw 1 -nr 1 --warg=--num_steps --warg=1 --rarg=--num_steps --rarg=1")
+set (2x1.OneStep_CMD "run_test.py.$<CONFIG> -nw 2 -nr 1 --warg=--num_steps --warg=1 --rarg=--num_steps --rarg=1")
+set (1x2.OneStep_CMD "run_test.py.$<CONFIG> -nw 1 -nr 2 --warg=--num_steps --warg=1 --rarg=--num_steps --rarg=1")
+set (3x5.OneStep_CMD "run_test.py.$<CONFIG> -nw 3 -nr 5 --warg=--num_steps --warg=1 --rarg=--num_steps --rarg=1")
 set (3x5LockGeometry_CMD "run_test.py.$<CONFIG> -nw 3 -nr 5 --warg=--num_steps --warg=50 --warg=--ms_delay --warg=10 --rarg=--num_steps --rarg=50 --warg=--lock_geometry --rarg=--lock_geometry")
 set (1x1EarlyExit_CMD "run_test.py.$<CONFIG> -nw 1 -nr 1 --warg=--num_steps --warg=50 --rarg=--num_steps --rarg=5 --rarg=--early_exit")
 set (3x5EarlyExit_CMD "run_test.py.$<CONFIG> -nw 3 -nr 5 --warg=--num_steps --warg=50 --rarg=--num_steps --rarg=5 --rarg=--early_exit")
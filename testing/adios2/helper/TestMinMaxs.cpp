@@ -2,6 +2,7 @@
  * Distributed under the OSI-approved Apache License, Version 2.0.  See
  * accompanying file Copyright.txt for details.
  */
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <cstring>
@@ -1170,6 +1171,152 @@ TEST(ADIOS2MinMaxs, ADIOS2MinMaxs_4D_3x2x5x4)
     }
 }
 
+TEST(ADIOS2MinMaxs, ADIOS2MinMaxs_Vectorized)
+{
+    // sizes around the vector widths exercise the scalar tails
+    for (const size_t size : {1, 7, 16, 33, 1000, 1023})
+    {
+        std::vector<double> data(size);
+        std::vector<float> dataf(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            data[i] = std::sin(static_cast<double>(i)) * 1000.0;
+            dataf[i] = static_cast<float>(data[i]);
+        }
+
+        double min, max, smin, smax;
+        adios2::helper::GetMinMax(data.data(), size, min, max);
+        adios2::helper::GetMinMaxScalar(data.data(), size, smin, smax);
+        EXPECT_EQ(min, smin);
+        EXPECT_EQ(max, smax);
+        EXPECT_EQ(min, *std::min_element(data.begin(), data.end()));
+        EXPECT_EQ(max, *std::max_element(data.begin(), data.end()));
+
+        // destination in a byte buffer is not aligned for double
+        std::vector<char> buffer(size * sizeof(double) + 1);
+        adios2::helper::CopyAndGetMinMax(data.data(), size, buffer.data() + 1,
+                                         min, max);
+        EXPECT_EQ(std::memcmp(buffer.data() + 1, data.data(),
+                              size * sizeof(double)),
+                  0);
+        EXPECT_EQ(min, smin);
+        EXPECT_EQ(max, smax);
+
+        float minf, maxf;
+        std::vector<float> copyf(size);
+        adios2::helper::CopyAndGetMinMax(
+            dataf.data(), size, reinterpret_cast<char *>(copyf.data()), minf,
+            maxf);
+        EXPECT_EQ(copyf, dataf);
+        EXPECT_EQ(minf, *std::min_element(dataf.begin(), dataf.end()));
+        EXPECT_EQ(maxf, *std::max_element(dataf.begin(), dataf.end()));
+
+        std::vector<int> datai(size);
+        std::vector<int> copyi(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            datai[i] = static_cast<int>(data[i]);
+        }
+        int mini, maxi;
+        adios2::helper::CopyAndGetMinMax(
+            datai.data(), size, reinterpret_cast<char *>(copyi.data()), mini,
+            maxi);
+        EXPECT_EQ(copyi, datai);
+        EXPECT_EQ(mini, *std::min_element(datai.begin(), datai.end()));
+        EXPECT_EQ(maxi, *std::max_element(datai.begin(), datai.end()));
+    }
+}
+
+TEST(ADIOS2MinMaxs, ADIOS2MinMaxs_NaN)
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    std::vector<double> data(100);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<double>(i) - 50.0;
+    }
+    // NaNs first, in the vector body and in the tail are all ignored
+    data[0] = nan;
+    data[10] = nan;
+    data[99] = nan;
+
+    double min, max;
+    adios2::helper::GetMinMax(data.data(), data.size(), min, max);
+    EXPECT_EQ(min, -49.0);
+    EXPECT_EQ(max, 48.0);
+
+    std::vector<double> copy(data.size());
+    adios2::helper::CopyAndGetMinMax(data.data(), data.size(),
+                                     reinterpret_cast<char *>(copy.data()),
+                                     min, max);
+    EXPECT_EQ(min, -49.0);
+    EXPECT_EQ(max, 48.0);
+    EXPECT_TRUE(std::isnan(copy[10]));
+
+    adios2::helper::GetMinMaxScalar(data.data(), data.size(), min, max);
+    EXPECT_EQ(min, -49.0);
+    EXPECT_EQ(max, 48.0);
+
+    // only NaNs
+    std::vector<float> nans(37, std::numeric_limits<float>::quiet_NaN());
+    float minf, maxf;
+    adios2::helper::GetMinMax(nans.data(), nans.size(), minf, maxf);
+    EXPECT_TRUE(std::isnan(minf));
+    EXPECT_TRUE(std::isnan(maxf));
+
+    // a subblock with only NaNs does not hide the others
+    std::fill(data.begin(), data.begin() + 50, nan);
+    const adios2::Dims count{100};
+    const adios2::helper::BlockDivisionInfo info = adios2::helper::DivideBlock(
+        count, 25, adios2::helper::BlockDivisionMethod::Contiguous);
+    std::vector<double> minMaxs;
+    adios2::helper::GetMinMaxSubblocks(data.data(), count, info, minMaxs, min,
+                                       max, 1);
+    EXPECT_EQ(min, 0.0);
+    EXPECT_EQ(max, 48.0);
+    EXPECT_TRUE(std::isnan(minMaxs[0]));
+}
+
+TEST(ADIOS2MinMaxs, ADIOS2MinMaxs_CopyAndSubblocks)
+{
+    // divided along the slowest dimension only, then along two dimensions
+    // (subblocks not contiguous) and large enough to use threads
+    const std::vector<std::pair<adios2::Dims, size_t>> cases = {
+        {{100, 10}, 100}, {{4, 24}, 5}, {{2048, 1024}, 1 << 18}};
+    for (const auto &c : cases)
+    {
+        const adios2::Dims &count = c.first;
+        const size_t nElems = adios2::helper::GetTotalSize(count);
+        std::vector<double> data(nElems);
+        for (size_t i = 0; i < nElems; ++i)
+        {
+            data[i] = std::cos(static_cast<double>(i)) * i;
+        }
+        const adios2::helper::BlockDivisionInfo info =
+            adios2::helper::DivideBlock(
+                count, c.second,
+                adios2::helper::BlockDivisionMethod::Contiguous);
+
+        std::vector<double> minMaxs, expectedMinMaxs;
+        double min, max, expectedMin, expectedMax;
+        adios2::helper::GetMinMaxSubblocks(data.data(), count, info,
+                                           expectedMinMaxs, expectedMin,
+                                           expectedMax, 1);
+        for (const unsigned int threads : {1, 4})
+        {
+            std::vector<double> copy(nElems);
+            adios2::helper::CopyAndGetMinMaxSubblocks(
+                data.data(), count, info,
+                reinterpret_cast<char *>(copy.data()), minMaxs, min, max,
+                threads);
+            EXPECT_EQ(copy, data);
+            EXPECT_EQ(minMaxs, expectedMinMaxs);
+            EXPECT_EQ(min, expectedMin);
+            EXPECT_EQ(max, expectedMax);
+        }
+    }
+}
+
 int main(int argc, char **argv)
 {
 
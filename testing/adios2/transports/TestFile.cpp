@@ -5,6 +5,7 @@
 #include <array>
 #include <stdexcept>
 #include <tuple>
+#include <vector>
 
 #include <adios2.h>
 
@@ -87,6 +88,9 @@ INSTANTIATE_TEST_SUITE_P(
                       std::make_tuple("posix", "false", "posix", "false"),
                       std::make_tuple("stdio", "true", "posix", "false"),
                       std::make_tuple("stdio", "false", "posix", "false"),
+                      std::make_tuple("posix", "false", "mmap", "false"),
+                      std::make_tuple("stdio", "true", "mmap", "false"),
+                      std::make_tuple("fstream", "false", "mmap", "false"),
 
                       std::make_tuple("stdio", "true", "stdio", "true"),
                       std::make_tuple("stdio", "true", "stdio", "false"),
@@ -127,6 +131,167 @@ INSTANTIATE_TEST_SUITE_P(
                       std::make_tuple("fstream", "false", "fstream", "false")));
 #endif
 
+#ifdef ADIOS2_HAVE_IOURING
+INSTANTIATE_TEST_SUITE_P(
+    IOUringTransportTests, BufferTest,
+    ::testing::Values(std::make_tuple("iouring", "false", "iouring", "false"),
+                      std::make_tuple("iouring", "false", "posix", "false"),
+                      std::make_tuple("posix", "false", "iouring", "false"),
+                      std::make_tuple("stdio", "true", "iouring", "false")));
+
+// many small chunks through a short queue, with sizes that don't divide
+class IOUringTest : public ::testing::TestWithParam<std::string>
+{
+};
+
+TEST_P(IOUringTest, ChunkedWriteRead)
+{
+    const std::string &engineType = GetParam();
+    const std::string fname("FileIOUringChunkedTest_" + engineType + ".bp");
+    const size_t Nx = 100000;
+
+    std::vector<double> dataOrig(Nx);
+    for (size_t i = 0; i < Nx; ++i)
+    {
+        dataOrig[i] = static_cast<double>(i);
+    }
+
+    adios2::ADIOS adios;
+    {
+        adios2::IO io = adios.DeclareIO("TestIO");
+
+        io.SetEngine(engineType);
+        const size_t transportID = io.AddTransport("file");
+        io.SetTransportParameter(transportID, "Library", "IOUring");
+        io.SetTransportParameter(transportID, "QueueDepth", "4");
+        io.SetTransportParameter(transportID, "ChunkSize", "4000");
+
+        auto var = io.DefineVariable<double>("var", {Nx}, {0}, {Nx});
+        adios2::Engine writer = io.Open(fname, adios2::Mode::Write);
+        for (size_t step = 0; step < 3; ++step)
+        {
+            writer.BeginStep();
+            writer.Put(var, dataOrig.data());
+            writer.EndStep();
+        }
+        writer.Close();
+    }
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+
+        io.SetEngine(engineType);
+        const size_t transportID = io.AddTransport("file");
+        io.SetTransportParameter(transportID, "Library", "IOUring");
+        io.SetTransportParameter(transportID, "QueueDepth", "3");
+        io.SetTransportParameter(transportID, "ChunkSize", "1001");
+
+        adios2::Engine reader = io.Open(fname, adios2::Mode::Read);
+        size_t steps = 0;
+        while (reader.BeginStep() == adios2::StepStatus::OK)
+        {
+            auto var = io.InquireVariable<double>("var");
+            ASSERT_TRUE(var);
+            std::vector<double> dataRead(Nx);
+            reader.Get(var, dataRead.data(), adios2::Mode::Sync);
+            reader.EndStep();
+            ASSERT_EQ(dataOrig, dataRead);
+            ++steps;
+        }
+        reader.Close();
+        ASSERT_EQ(steps, 3);
+    }
+}
+
+#ifdef ADIOS2_HAVE_BP5
+INSTANTIATE_TEST_SUITE_P(IOUringTransportTests, IOUringTest,
+                         ::testing::Values("BP4", "BP5"));
+#else
+INSTANTIATE_TEST_SUITE_P(IOUringTransportTests, IOUringTest,
+                         ::testing::Values("BP4"));
+#endif
+#endif
+
+#ifdef ADIOS2_HAVE_BP5
+// several reader threads on one subfile, each reading a piece of it
+class ThreadedReadTest : public ::testing::TestWithParam<std::string>
+{
+};
+
+TEST_P(ThreadedReadTest, OneSubFile)
+{
+    const std::string &transportLibrary = GetParam();
+    const std::string fname("FileThreadedReadTest_" + transportLibrary +
+                            ".bp");
+    const size_t nBlocks = 8;
+    const size_t Nx = 50000;
+
+    std::vector<double> dataOrig(nBlocks * Nx);
+    for (size_t i = 0; i < dataOrig.size(); ++i)
+    {
+        dataOrig[i] = static_cast<double>(i);
+    }
+
+    adios2::ADIOS adios;
+    {
+        adios2::IO io = adios.DeclareIO("TestIO");
+        io.SetEngine("BP5");
+        auto var =
+            io.DefineVariable<double>("var", {nBlocks * Nx}, {0}, {Nx});
+        adios2::Engine writer = io.Open(fname, adios2::Mode::Write);
+        writer.BeginStep();
+        for (size_t b = 0; b < nBlocks; ++b)
+        {
+            var.SetSelection({{b * Nx}, {Nx}});
+            writer.Put(var, dataOrig.data() + b * Nx, adios2::Mode::Sync);
+        }
+        writer.EndStep();
+        writer.Close();
+    }
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+        io.SetEngine("BP5");
+        io.SetParameter("Threads", "4");
+        const size_t transportID = io.AddTransport("file");
+        io.SetTransportParameter(transportID, "Library", transportLibrary);
+
+        adios2::Engine reader = io.Open(fname, adios2::Mode::Read);
+        ASSERT_EQ(reader.BeginStep(), adios2::StepStatus::OK);
+        auto var = io.InquireVariable<double>("var");
+        ASSERT_TRUE(var);
+
+        std::vector<double> dataRead(nBlocks * Nx);
+        reader.Get(var, dataRead.data());
+
+        // a selection across blocks, read into a second buffer
+        const size_t start = Nx / 2 + 3;
+        const size_t count = 3 * Nx + 7;
+        var.SetSelection({{start}, {count}});
+        std::vector<double> partRead(count);
+        reader.Get(var, partRead.data());
+
+        reader.EndStep();
+        reader.Close();
+
+        ASSERT_EQ(dataOrig, dataRead);
+        for (size_t i = 0; i < count; ++i)
+        {
+            ASSERT_EQ(partRead[i], dataOrig[start + i]);
+        }
+    }
+}
+
+#ifdef __unix__
+INSTANTIATE_TEST_SUITE_P(ThreadedReadTests, ThreadedReadTest,
+                         ::testing::Values("POSIX", "MMap", "stdio",
+                                           "fstream"));
+#else
+INSTANTIATE_TEST_SUITE_P(ThreadedReadTests, ThreadedReadTest,
+                         ::testing::Values("stdio", "fstream"));
+#endif
+#endif
+
 int main(int argc, char **argv)
 {
     int result;